@@ -0,0 +1,235 @@
+"""Cache the parsed and translated meta-model between the runs."""
+
+import hashlib
+import io
+import pathlib
+import pickle
+from typing import Any, MutableMapping, Optional, TextIO, Tuple
+
+import docutils.nodes
+
+import aas_core_codegen
+from aas_core_codegen import intermediate, specific_implementations
+from aas_core_codegen.common import LinenoColumner
+
+
+def compute_key(
+    model_text: str, spec_impls: specific_implementations.SpecificImplementations
+) -> str:
+    """
+    Compute the content-addressed key for the given inputs of a generation run.
+
+    The key changes whenever the meta-model source, any of the snippets or
+    the version of the generator changes, so a stale cache entry can never be
+    mistaken for a fresh one.
+    """
+    hasher = hashlib.sha256()
+
+    hasher.update(aas_core_codegen.__version__.encode("utf-8"))
+    hasher.update(b"\x00")
+    hasher.update(model_text.encode("utf-8"))
+
+    for key in sorted(spec_impls.keys()):
+        hasher.update(b"\x00")
+        hasher.update(key.encode("utf-8"))
+        hasher.update(b"\x00")
+        hasher.update(spec_impls[key].encode("utf-8"))
+
+    return hasher.hexdigest()
+
+
+# NOTE (mristin, 2022-07-12):
+# The descriptions in the symbol table hold docutils documents as produced by
+# ``docutils.core.publish_doctree``. Such a document references a live
+# ``reporter`` whose warning stream is an open file-like object, as well as
+# a ``transformer`` and the parsed ``settings``, none of which are picklable.
+# Sphinx faces the same problem and nulls out exactly these attributes before
+# it pickles a doctree. We do the same here, but without mutating the
+# in-memory document: the pickler below serializes the documents with these
+# attributes left out, and the reconstruction sets them to ``None``. The
+# loaded documents are only ever read by the generators, never transformed
+# or re-parsed, so they do not miss the machinery.
+
+#: Attributes of a docutils document which must not end up in a pickle
+_UNPICKLABLE_DOCUMENT_ATTRIBUTES = ("reporter", "transformer", "settings")
+
+
+def _new_document_shell() -> docutils.nodes.document:
+    """Create an empty document to be populated from the pickled state."""
+    return docutils.nodes.document.__new__(docutils.nodes.document)
+
+
+class _Pickler(pickle.Pickler):
+    """Pickle the objects with the docutils documents detached."""
+
+    def reducer_override(self, obj: Any) -> Any:
+        """Serialize the documents without the unpicklable machinery."""
+        if isinstance(obj, docutils.nodes.document):
+            state = {
+                key: value
+                for key, value in obj.__dict__.items()
+                if key not in _UNPICKLABLE_DOCUMENT_ATTRIBUTES
+            }  # type: MutableMapping[str, Any]
+
+            for key in _UNPICKLABLE_DOCUMENT_ATTRIBUTES:
+                state[key] = None
+
+            # NOTE (mristin, 2022-07-12):
+            # The state must go through the third element of the reduce tuple.
+            # The document is involved in reference cycles with its children,
+            # so it has to be memoized by the pickler *before* its state is
+            # serialized.
+            return _new_document_shell, (), state
+
+        return NotImplemented
+
+
+def _dumps(obj: Any) -> bytes:
+    """Serialize the ``obj`` with the docutils documents detached."""
+    buffer = io.BytesIO()
+    _Pickler(buffer, protocol=pickle.HIGHEST_PROTOCOL).dump(obj)
+    return buffer.getvalue()
+
+
+#: Magic prefix which identifies a compiled meta-model artifact
+_ARTIFACT_MAGIC = b"aas-core-codegen-ir\x00"
+
+
+def dump_artifact(
+    path: pathlib.Path,
+    symbol_table: intermediate.SymbolTable,
+    lineno_columner: LinenoColumner,
+) -> None:
+    """
+    Serialize the translated symbol table as a compiled meta-model artifact.
+
+    The artifact is versioned with the version of the generator, so that
+    a loader never deserializes an artifact produced by an incompatible
+    version. The artifact is first written to a temporary file and then
+    renamed so that a concurrent reader can never observe a half-written
+    artifact.
+
+    Unlike the best-effort run cache (see :py:func:`store`), failures are
+    propagated to the caller since the artifact is the very output of
+    the compilation.
+    """
+    payload = _dumps((symbol_table, lineno_columner))
+
+    data = (
+        _ARTIFACT_MAGIC + aas_core_codegen.__version__.encode("utf-8") + b"\x00"
+    ) + payload
+
+    tmp_path = path.with_name(path.name + ".part")
+    tmp_path.write_bytes(data)
+    tmp_path.replace(path)
+
+
+def load_artifact(
+    path: pathlib.Path,
+) -> Tuple[Optional[Tuple[intermediate.SymbolTable, LinenoColumner]], Optional[str]]:
+    """
+    Deserialize the compiled meta-model artifact from the ``path``.
+
+    :return:
+        the symbol table and the corresponding line/column resolver,
+        or an error message
+    """
+    try:
+        data = path.read_bytes()
+    except OSError as exception:
+        return None, f"Failed to read the artifact from {path}: {exception}"
+
+    if not data.startswith(_ARTIFACT_MAGIC):
+        return None, f"The file is not a compiled meta-model artifact: {path}"
+
+    version_end = data.find(b"\x00", len(_ARTIFACT_MAGIC))
+    if version_end == -1:
+        return None, f"The artifact header is corrupt: {path}"
+
+    version = data[len(_ARTIFACT_MAGIC) : version_end].decode(
+        "utf-8", errors="replace"
+    )
+    if version != aas_core_codegen.__version__:
+        return None, (
+            f"The artifact {path} has been compiled "
+            f"with aas-core-codegen {version}, "
+            f"but the current version is {aas_core_codegen.__version__}; "
+            f"please re-compile the meta-model"
+        )
+
+    try:
+        symbol_table, lineno_columner = pickle.loads(data[version_end + 1 :])
+    except Exception as exception:  # pylint: disable=broad-except
+        return None, f"Failed to deserialize the artifact from {path}: {exception}"
+
+    if not isinstance(symbol_table, intermediate.SymbolTable) or not isinstance(
+        lineno_columner, LinenoColumner
+    ):
+        return None, f"The artifact {path} does not contain a translated symbol table"
+
+    return (symbol_table, lineno_columner), None
+
+
+def load(
+    cache_dir: pathlib.Path, key: str
+) -> Optional[Tuple[intermediate.SymbolTable, LinenoColumner]]:
+    """
+    Try to load the translated symbol table for the given ``key``.
+
+    The cache is best-effort: a missing, corrupt or incompatible entry is
+    simply reported as a miss so that the caller falls back to the full
+    parsing and translation.
+
+    :return: the symbol table and the corresponding line/column resolver on a hit
+    """
+    path = cache_dir / f"{key}.pickle"
+
+    try:
+        data = path.read_bytes()
+    except OSError:
+        return None
+
+    try:
+        symbol_table, lineno_columner = pickle.loads(data)
+    except Exception:  # pylint: disable=broad-except
+        return None
+
+    if not isinstance(symbol_table, intermediate.SymbolTable) or not isinstance(
+        lineno_columner, LinenoColumner
+    ):
+        return None
+
+    return symbol_table, lineno_columner
+
+
+def store(
+    cache_dir: pathlib.Path,
+    key: str,
+    symbol_table: intermediate.SymbolTable,
+    lineno_columner: LinenoColumner,
+    stderr: TextIO,
+) -> None:
+    """
+    Persist the translated symbol table for the given ``key``.
+
+    The entry is first written to a temporary file and then renamed so that
+    a concurrent run can never observe a half-written entry. Failures do not
+    break the run — the cache only ever short-circuits work — but they are
+    reported as a warning on ``stderr`` so that a permanently failing cache
+    does not silently degrade to re-translating on every run.
+    """
+    try:
+        cache_dir.mkdir(parents=True, exist_ok=True)
+
+        data = _dumps((symbol_table, lineno_columner))
+
+        path = cache_dir / f"{key}.pickle"
+        tmp_path = cache_dir / f"{key}.pickle.part"
+
+        tmp_path.write_bytes(data)
+        tmp_path.replace(path)
+    except Exception as exception:  # pylint: disable=broad-except
+        stderr.write(
+            f"Warning: failed to store the cache entry "
+            f"in {cache_dir}: {exception}\n"
+        )
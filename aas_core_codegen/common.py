@@ -1,8 +1,11 @@
 """Provide common functions and types for the code generation."""
 import ast
+import bisect
+import contextlib
 import inspect
 import io
 import re
+import sys
 import textwrap
 from typing import (
     Optional,
@@ -16,6 +19,7 @@ from typing import (
     NoReturn,
     Any,
     Iterable,
+    TextIO,
 )
 
 import asttokens
@@ -30,7 +34,10 @@ class Identifier(DBC, str):
 
     @require(lambda value: IDENTIFIER_RE.fullmatch(value))
     def __new__(cls, value: str) -> "Identifier":
-        return cast(Identifier, value)
+        # NOTE (mristin, 2022-05-02):
+        # The identifiers are interned since the same ones are constructed and
+        # used as dictionary keys over and over again throughout the generation.
+        return cast(Identifier, sys.intern(value))
 
 
 class Error:
@@ -64,27 +71,47 @@ class LinenoColumner:
     """Map the source code to line number and column for precise error messages."""
 
     def __init__(self, atok: asttokens.ASTTokens) -> None:
-        positions = []  # type: List[Tuple[int, int]]
-        lineno = 1
-        column = 0
-        for character in atok.get_text(atok.tree):
-            if character == "\n":
-                column = 1
-                lineno += 1
-            else:
-                column += 1
-
-            positions.append((lineno, column))
-
         self.atok = atok
-        self.positions = positions
+
+        # NOTE (mristin, 2022-07-12):
+        # We used to pre-compute the (line, column) pair for every single
+        # character of the source. However, the index is only ever consulted
+        # when an error message is actually written, so on the happy path we
+        # paid the full scan of the source for nothing. We therefore build
+        # the index of the line starts lazily on the first resolution, and
+        # map an offset to its line by bisection.
+        self._line_starts = None  # type: Optional[List[int]]
+
+    def _lineno_column(self, start: int) -> Tuple[int, int]:
+        """Resolve the character offset ``start`` to a line number and a column."""
+        if self._line_starts is None:
+            line_starts = [0]
+            for i, character in enumerate(self.atok.get_text(self.atok.tree)):
+                if character == "\n":
+                    line_starts.append(i + 1)
+
+            self._line_starts = line_starts
+
+        lineno = bisect.bisect_right(self._line_starts, start)
+        column = start - self._line_starts[lineno - 1] + 1
+
+        # NOTE (mristin, 2022-07-12):
+        # The pre-computed index historically counted the newline which
+        # terminates the previous line as the first column of the next line,
+        # so all the columns on the lines after the first one are shifted by
+        # one. We deliberately keep that convention so that the reported
+        # messages remain stable.
+        if lineno > 1:
+            column += 1
+
+        return lineno, column
 
     def error_message(self, error: Error) -> str:
         """Generate the error message based on the unexpected observation."""
         prefix = ""
         if error.node is not None:
             start, _ = self.atok.get_text_range(node=error.node)
-            lineno, column = self.positions[start]
+            lineno, column = self._lineno_column(start)
 
             prefix = f"At line {lineno} and column {column}: "
 
@@ -220,6 +247,92 @@ class Stripped(Rstripped):
         return cast(Stripped, block)
 
 
+class CodeWriter:
+    """
+    Accumulate generated code and write it out in a single pass.
+
+    The indention is tracked as the state of the writer and prefixed to
+    the lines exactly once, as they are written. This avoids the churn of
+    repeatedly splitting, re-indenting and joining the intermediate blocks.
+
+    Whitespace-only lines are never indented, mirroring the behavior of
+    :py:func:`textwrap.indent`.
+    """
+
+    @require(lambda indention: len(indention) > 0 and indention.strip() == "")
+    def __init__(self, indention: str = "    ") -> None:
+        """Initialize the writer to indent by ``indention`` per level."""
+        self._indention = indention
+        self._level = 0
+        self._fragments = []  # type: List[str]
+        self._at_line_start = True
+        self._empty = True
+
+    @contextlib.contextmanager
+    def indented(self) -> Iterator[None]:
+        """Indent everything written within the ``with`` block by one level."""
+        self._level += 1
+        try:
+            yield
+        finally:
+            self._level -= 1
+
+    def write(self, text: str) -> None:
+        """Write the ``text``, indenting every contained line at its start."""
+        if len(text) == 0:
+            return
+
+        self._empty = False
+
+        prefix = self._indention * self._level
+        if prefix == "":
+            self._fragments.append(text)
+            self._at_line_start = text.endswith("\n")
+            return
+
+        out = []  # type: List[str]
+        for i, line in enumerate(text.split("\n")):
+            if i > 0:
+                out.append("\n")
+                self._at_line_start = True
+
+            if len(line) > 0:
+                if self._at_line_start and line.strip() != "":
+                    out.append(prefix)
+
+                out.append(line)
+                self._at_line_start = False
+
+        self._fragments.append("".join(out))
+
+    def write_line(self, line: str = "") -> None:
+        """Write the ``line`` followed by a new-line character."""
+        self.write(line)
+        self._fragments.append("\n")
+        self._at_line_start = True
+        self._empty = False
+
+    def write_block(self, block: str) -> None:
+        """
+        Write the ``block``, separated by an empty line from the previous one.
+
+        No separator is written before the very first block.
+        """
+        if not self._empty:
+            self.write("\n\n")
+
+        self.write(block)
+
+    def getvalue(self) -> str:
+        """Join the accumulated fragments into the resulting text."""
+        return "".join(self._fragments)
+
+    def write_to(self, stream: TextIO) -> None:
+        """Flush the accumulated fragments directly to the ``stream``."""
+        for fragment in self._fragments:
+            stream.write(fragment)
+
+
 def indent_but_first_line(text: str, indention: str) -> str:
     """
     Indent all but the first of the given ``text`` by ``indention``.
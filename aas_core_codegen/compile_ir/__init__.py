@@ -0,0 +1 @@
+"""Compile a meta-model into a serialized intermediate representation."""
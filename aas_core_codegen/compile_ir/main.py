@@ -0,0 +1,160 @@
+"""Compile a meta-model into a serialized intermediate representation."""
+
+import argparse
+import pathlib
+import sys
+from typing import TextIO
+
+import aas_core_codegen
+from aas_core_codegen import caching, parse, run, intermediate
+from aas_core_codegen.common import LinenoColumner
+import aas_core_codegen.compile_ir
+
+assert __doc__ == aas_core_codegen.compile_ir.__doc__
+
+
+def execute(
+    model_path: pathlib.Path,
+    output_path: pathlib.Path,
+    stdout: TextIO,
+    stderr: TextIO,
+) -> int:
+    """
+    Parse and translate the meta-model and serialize it as an artifact.
+
+    Downstream tooling loads the artifact through
+    :py:func:`aas_core_codegen.caching.load_artifact` instead of paying for
+    the full parsing and translation on every invocation.
+    """
+    text = model_path.read_text(encoding="utf-8")
+
+    atok, parse_exception = parse.source_to_atok(source=text)
+    if parse_exception:
+        if isinstance(parse_exception, SyntaxError):
+            stderr.write(
+                f"Failed to parse the meta-model {model_path}: "
+                f"invalid syntax at line {parse_exception.lineno}\n"
+            )
+        else:
+            stderr.write(
+                f"Failed to parse the meta-model {model_path}: " f"{parse_exception}\n"
+            )
+
+        return 1
+
+    assert atok is not None
+
+    import_errors = parse.check_expected_imports(atok=atok)
+    if import_errors:
+        run.write_error_report(
+            message="One or more unexpected imports in the meta-model",
+            errors=import_errors,
+            stderr=stderr,
+        )
+
+        return 1
+
+    lineno_columner = LinenoColumner(atok=atok)
+
+    parsed_symbol_table, error = parse.atok_to_symbol_table(atok=atok)
+    if error is not None:
+        run.write_error_report(
+            message=f"Failed to construct the symbol table from {model_path}",
+            errors=[lineno_columner.error_message(error)],
+            stderr=stderr,
+        )
+
+        return 1
+
+    assert parsed_symbol_table is not None
+
+    ir_symbol_table, error = intermediate.translate(
+        parsed_symbol_table=parsed_symbol_table,
+        atok=atok,
+    )
+    if error is not None:
+        run.write_error_report(
+            message=f"Failed to translate the parsed symbol table "
+            f"to intermediate symbol table "
+            f"based on {model_path}",
+            errors=[lineno_columner.error_message(error)],
+            stderr=stderr,
+        )
+
+        return 1
+
+    assert ir_symbol_table is not None
+
+    try:
+        caching.dump_artifact(
+            path=output_path,
+            symbol_table=ir_symbol_table,
+            lineno_columner=lineno_columner,
+        )
+    except Exception as exception:  # pylint: disable=broad-except
+        run.write_error_report(
+            message=f"Failed to write the compiled meta-model to {output_path}",
+            errors=[str(exception)],
+            stderr=stderr,
+        )
+
+        return 1
+
+    stdout.write(f"Meta-model compiled to: {output_path}\n")
+    return 0
+
+
+def main(prog: str) -> int:
+    """Execute the main routine."""
+    # NOTE (mristin, 2022-03-28):
+    # The module ``argparse`` is not flexible enough to understand special options such
+    # as ``--version`` so we manually hard-wire.
+    if "--version" in sys.argv and "--help" not in sys.argv:
+        print(aas_core_codegen.__version__)
+        return 0
+
+    parser = argparse.ArgumentParser(prog=prog, description=__doc__)
+    parser.add_argument("--model_path", help="path to the meta-model", required=True)
+    parser.add_argument(
+        "--output_path",
+        help="path to the compiled meta-model artifact",
+        required=True,
+    )
+    parser.add_argument(
+        "--version", help="show the current version and exit", action="store_true"
+    )
+    args = parser.parse_args()
+
+    model_path = pathlib.Path(args.model_path)
+    output_path = pathlib.Path(args.output_path)
+
+    if not model_path.exists():
+        sys.stderr.write(f"The --model_path does not exist: {model_path}\n")
+        return 1
+
+    if not model_path.is_file():
+        sys.stderr.write(f"The --model_path does not point to a file: {model_path}\n")
+        return 1
+
+    if not output_path.parent.is_dir():
+        sys.stderr.write(
+            f"The parent directory of the --output_path does not exist: "
+            f"{output_path.parent}\n"
+        )
+        return 1
+
+    return execute(
+        model_path=model_path,
+        output_path=output_path,
+        stdout=sys.stdout,
+        stderr=sys.stderr,
+    )
+
+
+def entry_point() -> int:
+    """Provide an entry point for a console script."""
+    return main(prog="aas-core-codegen-compile")
+
+
+if __name__ == "__main__":
+    sys.exit(main(prog="aas-core-codegen-compile"))
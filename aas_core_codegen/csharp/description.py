@@ -4,11 +4,13 @@ import collections
 import io
 import itertools
 import textwrap
+import weakref
 import xml.sax.saxutils
 from typing import (
     Tuple,
     Optional,
     List,
+    MutableMapping,
     OrderedDict,
     Union,
     Sequence,
@@ -940,40 +942,84 @@ def _to_text(node: _NodeUnion) -> str:
     return writer.getvalue()
 
 
+# NOTE (mristin, 2022-07-12):
+# Classes down the hierarchy share the description instances of the inherited
+# properties, so the same description is rendered over and over again. As the
+# rendering is pure, we memoize it on the description instance. We reference
+# the descriptions only weakly so that the cache entries die together with
+# the symbol table — an unbounded cache with strong references would pin
+# every past symbol table in memory when the generation runs repeatedly
+# in the same process, *e.g.*, in the watch mode.
+_SUMMARY_REMARKS_CACHE = (
+    weakref.WeakKeyDictionary()
+)  # type: MutableMapping[intermediate.SummaryRemarksDescription, Tuple[Optional[Stripped], Optional[List[Error]]]]
+
+
 def _generate_summary_remarks(
     description: intermediate.SummaryRemarksDescription,
 ) -> Tuple[Optional[Stripped], Optional[List[Error]]]:
     """Generate the documentation comment for a summary-remarks-constraints."""
+    cached = _SUMMARY_REMARKS_CACHE.get(description, None)
+    if cached is not None:
+        return cached
+
     node, errors = _render_summary_remarks(description=description)
     if errors is not None:
-        return None, errors
+        result = (
+            None,
+            errors,
+        )  # type: Tuple[Optional[Stripped], Optional[List[Error]]]
+    else:
+        assert node is not None
+
+        _compress_node_in_place(node=node)
+        text = _to_text(node)
 
-    assert node is not None
+        commented_lines = [
+            _slash_slash_slash_line(line) for line in text.splitlines()
+        ]
 
-    _compress_node_in_place(node=node)
-    text = _to_text(node)
+        result = Stripped("\n".join(commented_lines)), None
 
-    commented_lines = [_slash_slash_slash_line(line) for line in text.splitlines()]
+    _SUMMARY_REMARKS_CACHE[description] = result
+    return result
 
-    return Stripped("\n".join(commented_lines)), None
+
+# NOTE (mristin, 2022-07-12):
+# See the note on memoization above :func:`._generate_summary_remarks`.
+_SUMMARY_REMARKS_CONSTRAINTS_CACHE = (
+    weakref.WeakKeyDictionary()
+)  # type: MutableMapping[intermediate.SummaryRemarksConstraintsDescription, Tuple[Optional[Stripped], Optional[List[Error]]]]
 
 
 def _generate_summary_remarks_constraints(
     description: intermediate.SummaryRemarksConstraintsDescription,
 ) -> Tuple[Optional[Stripped], Optional[List[Error]]]:
     """Generate the documentation comment for a summary-remarks-constraints."""
+    cached = _SUMMARY_REMARKS_CONSTRAINTS_CACHE.get(description, None)
+    if cached is not None:
+        return cached
+
     node, errors = _render_summary_remarks_constraints(description=description)
     if errors is not None:
-        return None, errors
+        result = (
+            None,
+            errors,
+        )  # type: Tuple[Optional[Stripped], Optional[List[Error]]]
+    else:
+        assert node is not None
 
-    assert node is not None
+        _compress_node_in_place(node=node)
+        text = _to_text(node)
 
-    _compress_node_in_place(node=node)
-    text = _to_text(node)
+        commented_lines = [
+            _slash_slash_slash_line(line) for line in text.splitlines()
+        ]
 
-    commented_lines = [_slash_slash_slash_line(line) for line in text.splitlines()]
+        result = Stripped("\n".join(commented_lines)), None
 
-    return Stripped("\n".join(commented_lines)), None
+    _SUMMARY_REMARKS_CONSTRAINTS_CACHE[description] = result
+    return result
 
 
 def generate_comment_for_meta_model(
@@ -1087,6 +1133,13 @@ def _render_description_of_signature(
     return _List(items=result_items), None
 
 
+# NOTE (mristin, 2022-07-12):
+# See the note on memoization above :func:`._generate_summary_remarks`.
+_SIGNATURE_CACHE = (
+    weakref.WeakKeyDictionary()
+)  # type: MutableMapping[intermediate.DescriptionOfSignature, Tuple[Optional[Stripped], Optional[List[Error]]]]
+
+
 def generate_comment_for_signature(
     description: intermediate.DescriptionOfSignature,
 ) -> Tuple[Optional[Stripped], Optional[List[Error]]]:
@@ -1095,15 +1148,27 @@ def generate_comment_for_signature(
 
     A signature, in this context, means a function or a method signature.
     """
+    cached = _SIGNATURE_CACHE.get(description, None)
+    if cached is not None:
+        return cached
+
     node, errors = _render_description_of_signature(description=description)
     if errors is not None:
-        return None, errors
+        result = (
+            None,
+            errors,
+        )  # type: Tuple[Optional[Stripped], Optional[List[Error]]]
+    else:
+        assert node is not None
 
-    assert node is not None
+        _compress_node_in_place(node=node)
+        text = _to_text(node)
 
-    _compress_node_in_place(node=node)
-    text = _to_text(node)
+        commented_lines = [
+            _slash_slash_slash_line(line) for line in text.splitlines()
+        ]
 
-    commented_lines = [_slash_slash_slash_line(line) for line in text.splitlines()]
+        result = Stripped("\n".join(commented_lines)), None
 
-    return Stripped("\n".join(commented_lines)), None
+    _SIGNATURE_CACHE[description] = result
+    return result
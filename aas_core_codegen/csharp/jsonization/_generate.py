@@ -116,41 +116,66 @@ if (modelType == null)
         ),
     ]  # type: List[Stripped]
 
-    # region Write the switch block
+    # region Write the dispatch on the model type
 
-    switch_writer = io.StringIO()
-    switch_writer.write(
-        """\
-switch (modelType)
-{
+    # NOTE (mristin, 2022-07-12):
+    # The set of concrete classes is closed at generation time, so we can
+    # pre-compute the dispatch map once instead of emitting a chain of
+    # string comparisons for each deserialization call.
+
+    map_name = csharp_naming.private_property_name(
+        Identifier(f"{interface.name}_from_by_model_type")
+    )
+
+    map_writer = io.StringIO()
+    map_writer.write(
+        f"""\
+/// <summary>
+/// Map the JSON model type to the deserialization function for {name}.
+/// </summary>
+private static readonly Dictionary<string, DeserializeDelegate<Aas.{name}>>
+{I}{map_name} = (
+{II}new Dictionary<string, DeserializeDelegate<Aas.{name}>>()
+{II}{{
 """
     )
 
     for implementer in interface.implementers:
         model_type = naming.json_model_type(implementer.name)
         implementer_name = csharp_naming.class_name(implementer.name)
-        switch_writer.write(
+        map_writer.write(
             f"""\
-{I}case {csharp_common.string_literal(model_type)}:
-{II}return {implementer_name}From(
-{III}node, out error);
+{III}{{ {csharp_common.string_literal(model_type)}, {implementer_name}From }},
 """
         )
 
-    switch_writer.write(
+    map_writer.write(
         f"""\
-{I}default:
-{II}error = new Reporting.Error(
-{III}$"Unexpected model type for {name}: {{modelType}}");
-{II}return null;
-}}"""
+{II}}});"""
+    )
+
+    blocks.append(
+        Stripped(
+            f"""\
+if (!{map_name}.TryGetValue(
+{II}modelType,
+{II}out DeserializeDelegate<Aas.{name}>? fromMethod))
+{{
+{I}error = new Reporting.Error(
+{II}$"Unexpected model type for {name}: {{modelType}}");
+{I}return null;
+}}
+return fromMethod(node, out error);"""
+        )
     )
-    blocks.append(Stripped(switch_writer.getvalue()))
 
     # endregion
 
     writer = io.StringIO()
 
+    writer.write(map_writer.getvalue())
+    writer.write("\n\n")
+
     writer.write(
         f"""\
 /// <summary>
@@ -601,6 +626,19 @@ def _generate_deserialize_impl(
     blocks = [
         Stripped(
             f"""\
+/// <summary>
+/// Deserialize an instance of <typeparamref name="T" />
+/// from <paramref name="node" />.
+/// </summary>
+/// <param name="node">JSON node to be parsed</param>
+/// <param name="error">Error, if any, during the deserialization</param>
+/// <typeparam name="T">type of the deserialized instance</typeparam>
+internal delegate T? DeserializeDelegate<out T>(
+{I}Nodes.JsonNode node,
+{I}out Reporting.Error? error) where T : class;"""
+        ),
+        Stripped(
+            f"""\
 /// <summary>Convert <paramref name="node" /> to a boolean.</summary>
 /// <param name="node">JSON node to be parsed</param>
 /// <param name="error">Error, if any, during the deserialization</param>
@@ -895,6 +933,52 @@ public static Aas.{name} {name}From(
 }}"""
     )
 
+    # NOTE (mristin, 2022-07-12):
+    # We additionally provide a streaming entry point so that the client can
+    # deserialize directly from a <c>Utf8JsonReader</c> without materializing
+    # the whole input as a string first.
+
+    writer.write(
+        f"""\
+
+
+/// <summary>
+/// Deserialize an instance of {name} from <paramref name="reader" />.
+/// </summary>
+/// <remarks>
+/// The <paramref name="reader" /> is expected to be positioned either at
+/// the start of the input or at the JSON value corresponding to {name}.
+/// The value is read directly from the <paramref name="reader" /> without
+/// an intermediate string representation.
+/// </remarks>
+/// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+/// <exception cref="Jsonization.Exception">
+/// Thrown when the input is not a valid JSON
+/// representation of {name}.
+/// </exception>
+"""
+    )
+
+    if name.startswith("I"):
+        writer.write(
+            '[CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]\n'
+        )
+
+    writer.write(
+        f"""\
+public static Aas.{name} {name}From(
+{I}ref Json.Utf8JsonReader reader)
+{{
+{I}Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+{I}if (node == null)
+{I}{{
+{II}throw new Jsonization.Exception(
+{III}"", "Expected a JSON node, but got a null");
+{I}}}
+{I}return {name}From(node);
+}}"""
+    )
+
     return Stripped(writer.getvalue())
 
 
@@ -1527,6 +1611,7 @@ namespace {namespace}
         Stripped(
             """\
 using CodeAnalysis = System.Diagnostics.CodeAnalysis;
+using Json = System.Text.Json;
 using Nodes = System.Text.Json.Nodes;
 using System.Collections.Generic;  // can't alias"""
         ),
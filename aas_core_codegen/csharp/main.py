@@ -1,5 +1,8 @@
 """Generate C# code to handle asset administration shells based on the meta-model."""
-from typing import TextIO
+import json
+from typing import Optional, TextIO, Tuple
+
+from icontract import ensure
 
 from aas_core_codegen import specific_implementations, run, intermediate
 from aas_core_codegen.csharp import (
@@ -15,6 +18,65 @@ from aas_core_codegen.csharp import (
 )
 
 
+@ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
+def _parse_options(
+    spec_impls: specific_implementations.SpecificImplementations,
+) -> Tuple[Optional[bool], Optional[str]]:
+    """
+    Parse the ``csharp`` section of the optional ``options.json`` snippet.
+
+    The snippet is shared among all the targets, so the options live in
+    per-target sections, *e.g.*, ``{"csharp": {"shard_types": true}}``.
+    The sections of the other targets are deliberately ignored here — each
+    target validates only its own section.
+
+    :return: whether the types should be sharded per file, or the error
+    """
+    options_key = specific_implementations.ImplementationKey("options.json")
+
+    options_json = spec_impls.get(options_key, None)
+    if options_json is None:
+        return False, None
+
+    try:
+        options = json.loads(options_json)
+    except json.JSONDecodeError as err:
+        return None, f"Failed to parse the options from {options_key}: {err}"
+
+    if not isinstance(options, dict):
+        return None, (
+            f"Expected the options at {options_key} to be a JSON object, "
+            f"but got: {type(options)}"
+        )
+
+    section = options.get("csharp", None)
+    if section is None:
+        return False, None
+
+    if not isinstance(section, dict):
+        return None, (
+            f"Expected the ``csharp`` section of the options "
+            f"at {options_key} to be a JSON object, but got: {type(section)}"
+        )
+
+    unexpected_keys = sorted(set(section.keys()) - {"shard_types"})
+    if len(unexpected_keys) > 0:
+        return None, (
+            f"Unexpected properties in the ``csharp`` section of the options "
+            f"at {options_key}: {unexpected_keys}"
+        )
+
+    shard_types = section.get("shard_types", False)
+    if not isinstance(shard_types, bool):
+        return None, (
+            f"Expected the property ``shard_types`` in the ``csharp`` section "
+            f"of the options at {options_key} to be a boolean, "
+            f"but got: {type(shard_types)}"
+        )
+
+    return shard_types, None
+
+
 def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
     """Generate the code."""
     verified_ir_table, errors = csharp_structure.verify(
@@ -87,35 +149,80 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
 
     namespace = csharp_common.NamespaceIdentifier(namespace_text)
 
-    # region Structure
+    shard_types, options_error = _parse_options(spec_impls=context.spec_impls)
+    if options_error is not None:
+        stderr.write(f"{options_error}\n")
+        return 1
 
-    code, errors = csharp_structure.generate(
-        symbol_table=verified_ir_table,
-        namespace=namespace,
-        spec_impls=context.spec_impls,
-    )
+    assert shard_types is not None
 
-    if errors is not None:
-        run.write_error_report(
-            message=f"Failed to generate the structures in the C# code "
-            f"based on {context.model_path}",
-            errors=[context.lineno_columner.error_message(error) for error in errors],
-            stderr=stderr,
-        )
-        return 1
+    # region Structure
 
-    assert code is not None
+    if shard_types:
+        files, errors = csharp_structure.generate_sharded(
+            symbol_table=verified_ir_table,
+            namespace=namespace,
+            spec_impls=context.spec_impls,
+        )
 
-    pth = context.output_dir / "types.cs"
-    try:
-        pth.write_text(code, encoding="utf-8")
-    except Exception as exception:
-        run.write_error_report(
-            message=f"Failed to write the C# structures to {pth}",
-            errors=[str(exception)],
-            stderr=stderr,
+        if errors is not None:
+            run.write_error_report(
+                message=f"Failed to generate the structures in the C# code "
+                f"based on {context.model_path}",
+                errors=[
+                    context.lineno_columner.error_message(error) for error in errors
+                ],
+                stderr=stderr,
+            )
+            return 1
+
+        assert files is not None
+
+        types_dir = context.output_dir / "types"
+        types_dir.mkdir(exist_ok=True)
+
+        for file_name, code in files:
+            pth = types_dir / file_name
+            try:
+                run.write_if_different(pth, code)
+            except Exception as exception:
+                run.write_error_report(
+                    message=f"Failed to write the C# structures to {pth}",
+                    errors=[str(exception)],
+                    stderr=stderr,
+                )
+                return 1
+    else:
+        code, errors = csharp_structure.generate(
+            symbol_table=verified_ir_table,
+            namespace=namespace,
+            spec_impls=context.spec_impls,
+            profiler=context.profiler,
         )
-        return 1
+
+        if errors is not None:
+            run.write_error_report(
+                message=f"Failed to generate the structures in the C# code "
+                f"based on {context.model_path}",
+                errors=[
+                    context.lineno_columner.error_message(error) for error in errors
+                ],
+                stderr=stderr,
+            )
+            return 1
+
+        assert code is not None
+
+        pth = context.output_dir / "types.cs"
+        try:
+            run.write_if_different(pth, code)
+        except Exception as exception:
+            run.write_error_report(
+                message=f"Failed to write the C# structures to {pth}",
+                errors=[str(exception)],
+                stderr=stderr,
+            )
+            return 1
 
     # endregion
 
@@ -138,7 +245,7 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
 
     pth = context.output_dir / "visitation.cs"
     try:
-        pth.write_text(code, encoding="utf-8")
+        run.write_if_different(pth, code)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the visitation C# code to {pth}",
@@ -171,7 +278,7 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
     pth.parent.mkdir(exist_ok=True)
 
     try:
-        pth.write_text(code, encoding="utf-8")
+        run.write_if_different(pth, code)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the constants in the C# code to {pth}",
@@ -216,7 +323,7 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
 
     pth = context.output_dir / "verification.cs"
     try:
-        pth.write_text(code, encoding="utf-8")
+        run.write_if_different(pth, code)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the verification C# code to {pth}",
@@ -235,7 +342,7 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
     pth.parent.mkdir(exist_ok=True)
 
     try:
-        pth.write_text(code, encoding="utf-8")
+        run.write_if_different(pth, code)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the reporting C# code to {pth}",
@@ -267,7 +374,7 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
     pth.parent.mkdir(exist_ok=True)
 
     try:
-        pth.write_text(code, encoding="utf-8")
+        run.write_if_different(pth, code)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the stringification C# code to {pth}",
@@ -301,7 +408,7 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
     pth.parent.mkdir(exist_ok=True)
 
     try:
-        pth.write_text(code, encoding="utf-8")
+        run.write_if_different(pth, code)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the jsonization C# code to {pth}",
@@ -335,7 +442,7 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
     pth.parent.mkdir(exist_ok=True)
 
     try:
-        pth.write_text(code, encoding="utf-8")
+        run.write_if_different(pth, code)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the xmlization C# code to {pth}",
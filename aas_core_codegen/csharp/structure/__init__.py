@@ -4,3 +4,4 @@ from aas_core_codegen.csharp.structure import _generate
 
 verify = _generate.verify
 generate = _generate.generate
+generate_sharded = _generate.generate_sharded
@@ -1,4 +1,5 @@
 """Generate the C# data structures from the intermediate representation."""
+import concurrent.futures
 import io
 import textwrap
 from typing import (
@@ -9,14 +10,23 @@ from typing import (
     cast,
     Union,
     Mapping,
+    MutableMapping,
     Final,
 )
 
 from icontract import ensure, require
 
 from aas_core_codegen import intermediate
+from aas_core_codegen import profiling
 from aas_core_codegen import specific_implementations
-from aas_core_codegen.common import Error, Identifier, assert_never, Stripped, Rstripped
+from aas_core_codegen.common import (
+    CodeWriter,
+    Error,
+    Identifier,
+    assert_never,
+    Stripped,
+    Rstripped,
+)
 from aas_core_codegen.csharp import (
     common as csharp_common,
     naming as csharp_naming,
@@ -469,6 +479,7 @@ class _DescendBodyUnroller(csharp_unrolling.Unroller):
         descendability: Mapping[intermediate.TypeAnnotationUnion, bool],
     ) -> None:
         """Initialize with the given values."""
+        csharp_unrolling.Unroller.__init__(self)
         self._recurse = recurse
         self._descendability = descendability
 
@@ -601,17 +612,31 @@ def _generate_descend_body(cls: intermediate.ConcreteClass, recurse: bool) -> St
     """
     blocks = []  # type: List[Stripped]
 
+    # NOTE (mristin, 2022-07-12):
+    # We merge the descendability maps of the individual properties so that
+    # a single unroller can be shared over all the properties of the class and
+    # the repeated type annotation shapes hit its cache.
+    descendability = (
+        dict()
+    )  # type: MutableMapping[intermediate.TypeAnnotationUnion, bool]
+
+    relevant_props = []  # type: List[intermediate.Property]
+
     for prop in cls.properties:
-        descendability = intermediate.map_descendability(
+        prop_descendability = intermediate.map_descendability(
             type_annotation=prop.type_annotation
         )
 
-        if not descendability[prop.type_annotation]:
+        if not prop_descendability[prop.type_annotation]:
             continue
 
-        # region Unroll
+        descendability.update(prop_descendability)
+        relevant_props.append(prop)
 
-        unroller = _DescendBodyUnroller(recurse=recurse, descendability=descendability)
+    unroller = _DescendBodyUnroller(recurse=recurse, descendability=descendability)
+
+    for prop in relevant_props:
+        # region Unroll
 
         roots = unroller.unroll(
             unrollee_expr=csharp_naming.property_name(prop.name),
@@ -1103,25 +1128,11 @@ public T Transform<TContext, T>(
     return Stripped(writer.getvalue()), None
 
 
-# fmt: off
-@ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
-@ensure(
-    lambda result:
-    not (result[0] is not None) or result[0].endswith('\n'),
-    "Trailing newline mandatory for valid end-of-files"
-)
-# fmt: on
-def generate(
-    symbol_table: VerifiedIntermediateSymbolTable,
-    namespace: csharp_common.NamespaceIdentifier,
-    spec_impls: specific_implementations.SpecificImplementations,
-) -> Tuple[Optional[str], Optional[List[Error]]]:
-    """
-    Generate the C# code of the structures based on the symbol table.
-
-    The ``namespace`` defines the AAS C# namespace.
-    """
-    blocks = [csharp_common.WARNING]  # type: List[Rstripped]
+def _write_preamble(
+    writer: CodeWriter, namespace: csharp_common.NamespaceIdentifier
+) -> None:
+    """Write the warning, the using directives and the namespace opening."""
+    writer.write_block(csharp_common.WARNING)
 
     using_directives = [
         "using EnumMemberAttribute = System.Runtime.Serialization.EnumMemberAttribute;",
@@ -1129,17 +1140,17 @@ def generate(
     ]  # type: List[str]
 
     if len(using_directives) > 0:
-        blocks.append(Stripped("\n".join(using_directives)))
+        writer.write_block("\n".join(using_directives))
 
     if namespace != csharp_common.NamespaceIdentifier("Aas"):
-        blocks.append(Stripped(f"using Aas = {namespace};"))
+        writer.write_block(f"using Aas = {namespace};")
 
-    blocks.append(Stripped(f"namespace {namespace}\n{{"))
+    writer.write_block(f"namespace {namespace}\n{{")
 
-    blocks.append(
-        Rstripped(
-            textwrap.indent(
-                f"""\
+
+#: C# code of the general interface implemented by all the classes
+_ICLASS_BLOCK = Stripped(
+    f"""\
 /// <summary>
 /// Represent a general class of an AAS model.
 /// </summary>
@@ -1183,50 +1194,90 @@ public interface IClass
 {I}public T Transform<TContext, T>(
 {II}Visitation.ITransformerWithContext<TContext, T> transformer,
 {II}TContext context);
-}}""",
-                I,
-            )
+}}"""
+)
+
+
+def _generate_block_for_symbol(
+    something: Union[
+        intermediate.Enumeration, intermediate.Interface, intermediate.ConcreteClass
+    ],
+    spec_impls: specific_implementations.SpecificImplementations,
+) -> Tuple[Optional[Stripped], Optional[Error]]:
+    """Generate the code block for the given ``something`` of the symbol table."""
+    code = None  # type: Optional[Stripped]
+    error = None  # type: Optional[Error]
+
+    if (
+        isinstance(something, intermediate.Class)
+        and something.is_implementation_specific
+    ):
+        implementation_key = specific_implementations.ImplementationKey(
+            f"Types/{something.name}.cs"
         )
-    )
+
+        code = spec_impls.get(implementation_key, None)
+        if code is None:
+            error = Error(
+                something.parsed.node,
+                f"The implementation is missing "
+                f"for the implementation-specific class: "
+                f"{implementation_key}",
+            )
+    else:
+        if isinstance(something, intermediate.Enumeration):
+            # BEFORE-RELEASE (mristin, 2021-12-13): test in isolation
+            code, error = _generate_enum(enum=something)
+        elif isinstance(something, intermediate.Interface):
+            # BEFORE-RELEASE (mristin, 2021-12-13): test in isolation
+            code, error = _generate_interface(interface=something)
+
+        elif isinstance(something, intermediate.ConcreteClass):
+            # BEFORE-RELEASE (mristin, 2021-12-13): test in isolation
+            code, error = _generate_class(cls=something, spec_impls=spec_impls)
+        else:
+            assert_never(something)
+
+    assert (code is None) ^ (error is None)
+    return code, error
+
+
+# fmt: off
+@ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
+@ensure(
+    lambda result:
+    not (result[0] is not None) or result[0].endswith('\n'),
+    "Trailing newline mandatory for valid end-of-files"
+)
+# fmt: on
+def generate(
+    symbol_table: VerifiedIntermediateSymbolTable,
+    namespace: csharp_common.NamespaceIdentifier,
+    spec_impls: specific_implementations.SpecificImplementations,
+    profiler: Optional[profiling.Profiler] = None,
+) -> Tuple[Optional[str], Optional[List[Error]]]:
+    """
+    Generate the C# code of the structures based on the symbol table.
+
+    The ``namespace`` defines the AAS C# namespace.
+    """
+    writer = CodeWriter(indention=I)
+
+    _write_preamble(writer=writer, namespace=namespace)
+
+    with writer.indented():
+        writer.write_block(_ICLASS_BLOCK)
 
     errors = []  # type: List[Error]
 
     for something in csharp_common.over_enumerations_classes_and_interfaces(
         symbol_table
     ):
-        code = None  # type: Optional[Stripped]
-        error = None  # type: Optional[Error]
-
-        if (
-            isinstance(something, intermediate.Class)
-            and something.is_implementation_specific
-        ):
-            implementation_key = specific_implementations.ImplementationKey(
-                f"Types/{something.name}.cs"
+        with profiling.measure_if(profiler, f"csharp.structure.{something.name}"):
+            code, error = _generate_block_for_symbol(
+                something=something, spec_impls=spec_impls
             )
 
-            code = spec_impls.get(implementation_key, None)
-            if code is None:
-                error = Error(
-                    something.parsed.node,
-                    f"The implementation is missing "
-                    f"for the implementation-specific class: {implementation_key}",
-                )
-        else:
-            if isinstance(something, intermediate.Enumeration):
-                # BEFORE-RELEASE (mristin, 2021-12-13): test in isolation
-                code, error = _generate_enum(enum=something)
-            elif isinstance(something, intermediate.Interface):
-                # BEFORE-RELEASE (mristin, 2021-12-13): test in isolation
-                code, error = _generate_interface(interface=something)
-
-            elif isinstance(something, intermediate.ConcreteClass):
-                # BEFORE-RELEASE (mristin, 2021-12-13): test in isolation
-                code, error = _generate_class(cls=something, spec_impls=spec_impls)
-            else:
-                assert_never(something)
-
-        assert (code is None) ^ (error is None)
         if error is not None:
             errors.append(
                 Error(
@@ -1237,25 +1288,117 @@ public interface IClass
             )
         else:
             assert code is not None
-            blocks.append(Rstripped(textwrap.indent(code, "    ")))
+            with writer.indented():
+                writer.write_block(code)
 
     if len(errors) > 0:
         return None, errors
 
-    blocks.append(Rstripped(f"}}  // namespace {namespace}"))
+    writer.write_block(f"}}  // namespace {namespace}")
 
-    blocks.append(csharp_common.WARNING)
+    writer.write_block(csharp_common.WARNING)
 
-    out = io.StringIO()
-    for i, block in enumerate(blocks):
-        if i > 0:
-            out.write("\n\n")
+    writer.write("\n")
+
+    return writer.getvalue(), None
 
-        out.write(block)
 
-    out.write("\n")
+def _assemble_compilation_unit(
+    namespace: csharp_common.NamespaceIdentifier, block: Stripped
+) -> str:
+    """Wrap the code ``block`` in a complete compilation unit."""
+    writer = CodeWriter(indention=I)
+
+    _write_preamble(writer=writer, namespace=namespace)
+
+    with writer.indented():
+        writer.write_block(block)
+
+    writer.write_block(f"}}  // namespace {namespace}")
+
+    writer.write_block(csharp_common.WARNING)
+
+    writer.write("\n")
+
+    return writer.getvalue()
+
+
+# fmt: off
+@ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
+@ensure(
+    lambda result:
+    not (result[0] is not None)
+    or all(code.endswith('\n') for _, code in result[0]),
+    "Trailing newline mandatory for valid end-of-files"
+)
+# fmt: on
+def generate_sharded(
+    symbol_table: VerifiedIntermediateSymbolTable,
+    namespace: csharp_common.NamespaceIdentifier,
+    spec_impls: specific_implementations.SpecificImplementations,
+) -> Tuple[Optional[List[Tuple[str, str]]], Optional[List[Error]]]:
+    """
+    Generate the C# code of the structures sharded into one file per type.
+
+    Each file is a complete compilation unit so that a downstream build can
+    compile the types incrementally instead of re-compiling one monolithic
+    file on every regeneration. The code blocks for the types are generated
+    concurrently over a thread pool.
+
+    :return: the list of (file name, code) pairs, or the errors
+    """
+    files = [
+        ("IClass.cs", _assemble_compilation_unit(namespace, _ICLASS_BLOCK))
+    ]  # type: List[Tuple[str, str]]
+
+    somethings = list(
+        csharp_common.over_enumerations_classes_and_interfaces(symbol_table)
+    )
+
+    # NOTE (mristin, 2022-06-11):
+    # The code blocks of the types do not depend on each other, so we can
+    # generate them concurrently. The results are collected in the original
+    # order so that the reported errors remain deterministic.
+    with concurrent.futures.ThreadPoolExecutor() as executor:
+        blocks = list(
+            executor.map(
+                lambda something: _generate_block_for_symbol(
+                    something=something, spec_impls=spec_impls
+                ),
+                somethings,
+            )
+        )
+
+    errors = []  # type: List[Error]
+
+    for something, (code, error) in zip(somethings, blocks):
+        if error is not None:
+            errors.append(
+                Error(
+                    something.parsed.node,
+                    f"Failed to generate the code for {something.name!r}",
+                    [error],
+                )
+            )
+            continue
+
+        assert code is not None
+
+        if isinstance(something, intermediate.Enumeration):
+            file_name = f"{csharp_naming.enum_name(something.name)}.cs"
+        elif isinstance(something, intermediate.Interface):
+            file_name = f"{csharp_naming.interface_name(something.name)}.cs"
+        elif isinstance(something, intermediate.ConcreteClass):
+            file_name = f"{csharp_naming.class_name(something.name)}.cs"
+        else:
+            assert_never(something)
+
+        files.append((file_name, _assemble_compilation_unit(namespace, code)))
+
+    if len(errors) > 0:
+        return None, errors
 
-    return out.getvalue(), None
+    return files, None
 
 
 # endregion
@@ -2,7 +2,7 @@
 import abc
 import io
 import textwrap
-from typing import Sequence, List
+from typing import Generator, List, MutableMapping, Optional, Sequence, Tuple
 
 from icontract import DBC, require
 
@@ -19,21 +19,11 @@ class Node:
         self.children = children
 
 
-def render(node: Node) -> str:
+def _transcribe(node: Node) -> Generator[Node, Optional[str], str]:
     """
-    Render the node recursively.
-
-    >>> render(Node(text='something', children=[]))
-    'something'
+    Render the ``node``, yielding the children to be rendered separately.
 
-    >>> render(Node(text='parent', children=[Node(text='child', children=[])]))
-    'parent\\n{\\n    child\\n}'
-
-    >>> render(Node(text='parent', children=[
-    ...     Node(text='child1', children=[]),
-    ...     Node(text='child2', children=[]),
-    ... ]))
-    'parent\\n{\\n    child1\\n\\n    child2\\n}'
+    The renderings of the children are sent back to the generator.
     """
     if len(node.children) == 0:
         return node.text
@@ -48,16 +38,73 @@ def render(node: Node) -> str:
         else:
             writer.write("\n\n")
 
-        writer.write(textwrap.indent(render(child), I))
+        child_str = yield child
+        assert child_str is not None
+
+        writer.write(textwrap.indent(child_str, I))
 
     writer.write("\n}")
 
     return writer.getvalue()
 
 
+def render(node: Node) -> str:
+    """
+    Render the node including all its children.
+
+    >>> render(Node(text='something', children=[]))
+    'something'
+
+    >>> render(Node(text='parent', children=[Node(text='child', children=[])]))
+    'parent\\n{\\n    child\\n}'
+
+    >>> render(Node(text='parent', children=[
+    ...     Node(text='child1', children=[]),
+    ...     Node(text='child2', children=[]),
+    ... ]))
+    'parent\\n{\\n    child1\\n\\n    child2\\n}'
+    """
+    # NOTE (mristin, 2022-07-12):
+    # We maintain an explicit stack of generators instead of recursing so that
+    # deeply nested type annotations can not approach the recursion limit.
+    stack = [_transcribe(node)]  # type: List[Generator[Node, Optional[str], str]]
+
+    rendered = None  # type: Optional[str]
+
+    while len(stack) > 0:
+        try:
+            child = stack[-1].send(rendered)
+            rendered = None
+            stack.append(_transcribe(child))
+        except StopIteration as stop:
+            stack.pop()
+            rendered = stop.value
+
+    assert rendered is not None
+    return rendered
+
+
+#: Arguments of :py:meth:`Unroller.unroll` under which the unrolled nodes are cached
+_CacheKey = Tuple[str, str, Tuple[str, ...], int, int]
+
+
 class Unroller(DBC):
     """Generate code to unroll recursion into generic types."""
 
+    def __init__(self) -> None:
+        """Initialize the unroller with an empty cache of the unrolled nodes."""
+        # NOTE (mristin, 2022-07-12):
+        # The meta-models re-use only a handful of type annotation shapes over
+        # hundreds of properties, so we memoize the unrolled nodes. The type
+        # annotations are represented in the key by their string representation,
+        # which identifies the shape uniquely since the names of our types are
+        # unique in the symbol table. Mind that the remaining arguments have to
+        # be part of the key as well since the generated code embeds them.
+        #
+        # The cached nodes are shared among the cache hits and must therefore
+        # not be mutated by the caller.
+        self._cache = dict()  # type: MutableMapping[_CacheKey, List[Node]]
+
     @staticmethod
     @require(lambda level: level >= 0)
     @require(lambda suffix: suffix in ("Item", "KeyValue"))
@@ -112,6 +159,38 @@ class Unroller(DBC):
 
             Level 0 indicates the outer loop.
         """
+        key = (
+            unrollee_expr,
+            str(type_annotation),
+            tuple(path),
+            item_level,
+            key_value_level,
+        )  # type: _CacheKey
+
+        cached = self._cache.get(key, None)
+        if cached is not None:
+            return list(cached)
+
+        result = self._dispatch(
+            unrollee_expr=unrollee_expr,
+            type_annotation=type_annotation,
+            path=path,
+            item_level=item_level,
+            key_value_level=key_value_level,
+        )
+
+        self._cache[key] = result
+        return list(result)
+
+    def _dispatch(
+        self,
+        unrollee_expr: str,
+        type_annotation: intermediate.TypeAnnotationUnion,
+        path: List[str],
+        item_level: int,
+        key_value_level: int,
+    ) -> List[Node]:
+        """Dispatch to the unrolling of the specific ``type_annotation``."""
         if isinstance(type_annotation, intermediate.PrimitiveTypeAnnotation):
             return self._unroll_primitive_type_annotation(
                 unrollee_expr=unrollee_expr,
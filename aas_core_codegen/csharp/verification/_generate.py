@@ -8,6 +8,7 @@ from typing import (
     Sequence,
     Set,
     Mapping,
+    MutableMapping,
     Union,
 )
 
@@ -699,11 +700,28 @@ private static Regex {construct_name}()
         return None, error
     assert pattern_expr is not None
 
+    # NOTE (mristin, 2022-07-12):
+    # We compile the regular expression to intermediate language so that the
+    # matching is fast. The compilation is costly, but the cost is amortized
+    # since the regular expression is initialized lazily and only once (see
+    # below).
+
     # A pragmatic heuristics for breaking lines
     if len(pattern_expr) < 50:
-        writer.write(textwrap.indent(f"return new Regex({pattern_expr});\n", I))
+        writer.write(
+            textwrap.indent(
+                f"return new Regex({pattern_expr}, RegexOptions.Compiled);\n", I
+            )
+        )
     else:
-        writer.write(textwrap.indent(f"return new Regex(\n{I}{pattern_expr});\n", I))
+        writer.write(
+            textwrap.indent(
+                f"return new Regex(\n"
+                f"{I}{pattern_expr},\n"
+                f"{I}RegexOptions.Compiled);\n",
+                I,
+            )
+        )
 
     writer.write("}")
 
@@ -717,8 +735,16 @@ private static Regex {construct_name}()
     # We make this property look "public" since it is static and read-only.
     regex_name = csharp_naming.property_name(Identifier(f"regex_{verification.name}"))
 
+    # NOTE (mristin, 2022-07-12):
+    # We initialize the regular expression lazily so that the client does not
+    # pay the compilation cost for the patterns which are never matched.
+
     blocks.append(
-        Stripped(f"private static readonly Regex {regex_name} = {construct_name}();")
+        Stripped(
+            f"""\
+private static readonly System.Lazy<Regex> {regex_name} =
+{I}new System.Lazy<Regex>({construct_name});"""
+        )
     )
 
     assert len(verification.arguments) == 1
@@ -756,7 +782,7 @@ private static Regex {construct_name}()
         f"""\
 public static bool {method_name}(string {arg_name})
 {{
-{I}return {regex_name}.IsMatch({arg_name});
+{I}return {regex_name}.Value.IsMatch({arg_name});
 }}"""
     )
 
@@ -1480,11 +1506,43 @@ if (that.{prop_name} != null)
         return verify_block, None
 
 
+@ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
+def _transpile_invariant_cached(
+    invariant: intermediate.Invariant,
+    symbol_table: intermediate.SymbolTable,
+    environment: intermediate_type_inference.Environment,
+    cache: MutableMapping[int, Stripped],
+) -> Tuple[Optional[Stripped], Optional[Error]]:
+    """
+    Transpile the ``invariant`` or re-use the code transpiled before.
+
+    The invariants are stacked over the descendants, so the same invariant
+    object is encountered once per class which inherits it. The transpiled code
+    depends only on the invariant itself, not on the inheriting class, so we
+    infer the types and transpile each distinct invariant exactly once per run
+    and look it up in the ``cache`` afterwards.
+    """
+    code = cache.get(id(invariant), None)
+    if code is not None:
+        return code, None
+
+    code, error = _transpile_invariant(
+        invariant=invariant, symbol_table=symbol_table, environment=environment
+    )
+
+    if error is None:
+        assert code is not None
+        cache[id(invariant)] = code
+
+    return code, error
+
+
 @ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
 def _generate_transform_for_class(
     cls: intermediate.ConcreteClass,
     symbol_table: intermediate.SymbolTable,
     base_environment: intermediate_type_inference.Environment,
+    invariant_transpilation_cache: MutableMapping[int, Stripped],
 ) -> Tuple[Optional[Stripped], Optional[List[Error]]]:
     """Generate the transform method to errors for the given concrete class."""
     errors = []  # type: List[Error]
@@ -1503,8 +1561,11 @@ def _generate_transform_for_class(
     )
 
     for invariant in cls.invariants:
-        invariant_code, error = _transpile_invariant(
-            invariant=invariant, symbol_table=symbol_table, environment=environment
+        invariant_code, error = _transpile_invariant_cached(
+            invariant=invariant,
+            symbol_table=symbol_table,
+            environment=environment,
+            cache=invariant_transpilation_cache,
         )
         if error is not None:
             errors.append(
@@ -1568,6 +1629,7 @@ def _generate_transformer(
     symbol_table: intermediate.SymbolTable,
     base_environment: intermediate_type_inference.Environment,
     spec_impls: specific_implementations.SpecificImplementations,
+    invariant_transpilation_cache: MutableMapping[int, Stripped],
 ) -> Tuple[Optional[Stripped], Optional[List[Error]]]:
     """Generate a transformer to double-dispatch an instance to errors."""
     errors = []  # type: List[Error]
@@ -1610,6 +1672,7 @@ def _generate_transformer(
                     cls=our_type,
                     symbol_table=symbol_table,
                     base_environment=base_environment,
+                    invariant_transpilation_cache=invariant_transpilation_cache,
                 )
                 if cls_errors is not None:
                     errors.extend(cls_errors)
@@ -1667,6 +1730,7 @@ def _generate_verify_constrained_primitive(
     constrained_primitive: intermediate.ConstrainedPrimitive,
     symbol_table: intermediate.SymbolTable,
     base_environment: intermediate_type_inference.Environment,
+    invariant_transpilation_cache: MutableMapping[int, Stripped],
 ) -> Tuple[Optional[Stripped], Optional[List[Error]]]:
     """Generate the verify function for the constrained primitives."""
     errors = []  # type: List[Error]
@@ -1685,8 +1749,11 @@ def _generate_verify_constrained_primitive(
     )
 
     for invariant in constrained_primitive.invariants:
-        invariant_code, error = _transpile_invariant(
-            invariant=invariant, symbol_table=symbol_table, environment=environment
+        invariant_code, error = _transpile_invariant_cached(
+            invariant=invariant,
+            symbol_table=symbol_table,
+            environment=environment,
+            cache=invariant_transpilation_cache,
         )
         if error is not None:
             errors.append(
@@ -1770,6 +1837,7 @@ def generate(
             f"""\
 using CodeAnalysis = System.Diagnostics.CodeAnalysis;
 using Regex = System.Text.RegularExpressions.Regex;
+using RegexOptions = System.Text.RegularExpressions.RegexOptions;
 using System.Collections.Generic;  // can't alias
 using System.Linq;  // can't alias
 
@@ -1784,6 +1852,13 @@ using Aas = {namespace};"""
         symbol_table=symbol_table
     )
 
+    # NOTE (mristin, 2022-06-11):
+    # The invariants are stacked over the descendants, so the same invariant is
+    # encountered once per class which inherits it. We infer the types and
+    # transpile each distinct invariant only once, and share the result over
+    # this cache.
+    invariant_transpilation_cache = dict()  # type: MutableMapping[int, Stripped]
+
     for verification in symbol_table.verification_functions:
         if isinstance(verification, intermediate.ImplementationSpecificVerification):
             implementation_key = specific_implementations.ImplementationKey(
@@ -1844,6 +1919,7 @@ private static readonly Verification.Transformer _transformer = (
         symbol_table=symbol_table,
         base_environment=base_environment,
         spec_impls=spec_impls,
+        invariant_transpilation_cache=invariant_transpilation_cache,
     )
     if transformer_errors is not None:
         errors.extend(transformer_errors)
@@ -1883,6 +1959,7 @@ public static IEnumerable<Reporting.Error> Verify(Aas.IClass that)
                 constrained_primitive=our_type,
                 symbol_table=symbol_table,
                 base_environment=base_environment,
+                invariant_transpilation_cache=invariant_transpilation_cache,
             )
 
             if constrained_primitive_errors is not None:
@@ -1217,13 +1217,114 @@ public static Aas.{name} {name}From(
 }}"""
     )
 
+    # NOTE (mristin, 2022-07-12):
+    # We additionally provide an asynchronous entry point for the readers over
+    # network streams. The element is first pumped with ``ReadAsync`` into
+    # a pooled in-memory buffer, and then deserialized synchronously from
+    # the buffer.
+
+    writer.write(
+        f"""\
+
+
+/// <summary>
+/// Asynchronously deserialize an instance of {name}
+/// from <paramref name="reader" />.
+/// </summary>
+/// <remarks>
+/// The element is first read asynchronously into a pooled in-memory
+/// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+/// deserialized from the buffer. The <paramref name="reader" /> must be
+/// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+/// </remarks>
+/// <param name="reader">Initialized XML reader with cursor set to the element</param>
+/// <param name="ns">
+/// The expected namespace that the XML elements live in.
+/// If not specified, assume the element names as-are instead of the local names.
+/// </param>
+/// <exception cref="Xmlization.Exception">
+/// Thrown when the element is not a valid XML
+/// representation of {name}.
+/// </exception>
+"""
+    )
+
+    if name.startswith("I"):
+        writer.write(
+            """\
+[CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]"""
+        )
+
+    writer.write(
+        f"""\
+public static async Tasks.Task<Aas.{name}> {name}FromAsync(
+{I}Xml.XmlReader reader,
+{I}string? ns = null)
+{{
+{I}string buffer = await ReadElementIntoBufferAsync(reader);
+{I}using (var bufferedReader = Xml.XmlReader.Create(
+{II}new System.IO.StringReader(buffer)))
+{I}{{
+{II}return {name}From(bufferedReader, ns);
+{I}}}
+}}"""
+    )
+
     return Stripped(writer.getvalue())
 
 
 def _generate_deserialize(symbol_table: intermediate.SymbolTable) -> Stripped:
     """Generate the public class ``Deserialize``."""
 
-    blocks = []  # type: List[Stripped]
+    blocks = [
+        Stripped(
+            f"""\
+/// <summary>
+/// Pool the builders used to buffer the XML elements
+/// during the asynchronous deserialization.
+/// </summary>
+private static readonly System.Collections.Concurrent.ConcurrentBag<System.Text.StringBuilder>
+{I}_builderPool = (
+{II}new System.Collections.Concurrent.ConcurrentBag<System.Text.StringBuilder>());"""
+        ),
+        Stripped(
+            f"""\
+/// <summary>
+/// Asynchronously read the element at the cursor of
+/// <paramref name="reader" /> into an in-memory buffer.
+/// </summary>
+/// <remarks>
+/// The builders underlying the buffers are pooled so that the repeated
+/// calls do not allocate a builder for each element anew.
+/// </remarks>
+private static async Tasks.Task<string> ReadElementIntoBufferAsync(
+{I}Xml.XmlReader reader)
+{{
+{I}if (!_builderPool.TryTake(out System.Text.StringBuilder? builder))
+{I}{{
+{II}builder = new System.Text.StringBuilder();
+{I}}}
+{I}try
+{I}{{
+{II}var writerSettings = new Xml.XmlWriterSettings
+{II}{{
+{III}Async = true,
+{III}ConformanceLevel = Xml.ConformanceLevel.Fragment
+{II}}};
+{II}using (var writer = Xml.XmlWriter.Create(builder, writerSettings))
+{II}{{
+{III}await writer.WriteNodeAsync(reader, false);
+{II}}}
+{II}return builder.ToString();
+{I}}}
+{I}finally
+{I}{{
+{II}builder.Clear();
+{II}_builderPool.Add(builder);
+{I}}}
+}}"""
+        ),
+    ]  # type: List[Stripped]
     for our_type in symbol_table.our_types:
         if isinstance(our_type, intermediate.Enumeration):
             # NOTE (mristin, 2022-04-13):
@@ -2036,6 +2137,7 @@ namespace {namespace}
         Stripped(
             """\
 using CodeAnalysis = System.Diagnostics.CodeAnalysis;
+using Tasks = System.Threading.Tasks;
 using Xml = System.Xml;
 using System.Collections.Generic;  // can't alias"""
         ),
@@ -238,39 +238,67 @@ def _topologically_sort(
 
     visited_more_than_once = None  # type: Optional[parse.Class]
 
+    # NOTE (mristin, 2022-07-12):
+    # We used to implement the depth-first search recursively. However, the
+    # recursion depth equals the length of the longest inheritance chain, so
+    # a sufficiently deep hierarchy hit the Python recursion limit. We thus
+    # keep an explicit stack of (class, iterator over the parents) pairs which
+    # mirrors the recursive visit exactly, including the resulting order.
+    #
+    # The sort runs in time linear in the number of classes and inheritance
+    # edges, modulo the logarithmic factor of the sorted containers which we
+    # need for the deterministic order.
+
     def visit(cls: parse.Class) -> None:
         nonlocal visited_more_than_once
-        nonlocal result
-
-        if visited_more_than_once:
-            return
 
         if cls in permanent_marks:
             return
 
-        if cls in temporary_marks:
-            visited_more_than_once = cls
-            return
+        assert cls not in temporary_marks, (
+            f"The class {cls.name} is expected to carry no temporary mark "
+            f"at the start of a visit"
+        )
 
         temporary_marks.add(cls)
+        stack = [(cls, iter(cls.inheritances))]
 
-        for an_identifier in cls.inheritances:
-            # We ignore the primitive types from which constrained primitive types
-            # inherit.
-            if an_identifier in parse.PRIMITIVE_TYPES:
-                continue
+        while len(stack) > 0:
+            node, parent_iterator = stack[-1]
 
-            another_cls = parsed_symbol_table.must_find_class(an_identifier)
+            descended = False
+            for an_identifier in parent_iterator:
+                # We ignore the primitive types from which constrained primitive types
+                # inherit.
+                if an_identifier in parse.PRIMITIVE_TYPES:
+                    continue
+
+                another_cls = parsed_symbol_table.must_find_class(an_identifier)
+
+                if another_cls in permanent_marks:
+                    continue
+
+                if another_cls in temporary_marks:
+                    visited_more_than_once = another_cls
+                    return
+
+                temporary_marks.add(another_cls)
+                stack.append((another_cls, iter(another_cls.inheritances)))
+                descended = True
+                break
+
+            if descended:
+                continue
 
-            visit(cls=another_cls)
+            stack.pop()
 
-        temporary_marks.remove(cls)
-        permanent_marks.add(cls)
+            temporary_marks.remove(node)
+            permanent_marks.add(node)
 
-        if cls in without_permanent_marks:
-            without_permanent_marks.remove(cls)
+            if node in without_permanent_marks:
+                without_permanent_marks.remove(node)
 
-        result.append(cls)
+            result.append(node)
 
     while len(without_permanent_marks) > 0 and not visited_more_than_once:
         visit(without_permanent_marks[0])
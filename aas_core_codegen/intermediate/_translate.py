@@ -1,6 +1,7 @@
 """Translate the parsed representation into the intermediate representation."""
 import ast
 import collections
+import concurrent.futures
 import itertools
 import re
 from typing import (
@@ -4590,10 +4591,10 @@ def translate(
 
     # Type annotations reference placeholders for our types at this point.
 
-    our_types = []  # type: List[OurType]
-    for parsed_our_type in parsed_symbol_table.our_types:
-        our_type = None  # type: Optional[OurType]
-
+    def translate_our_type(
+        parsed_our_type: parse.OurType,
+    ) -> Tuple[Optional[OurType], Optional[Error]]:
+        """Translate the single ``parsed_our_type`` in the first pass."""
         constrainee = constrained_primitives_by_name.get(parsed_our_type.name, None)
 
         if constrainee is not None:
@@ -4603,29 +4604,23 @@ def translate(
 
             our_type, parsing_errors = _to_constrained_primitive(
                 parsed=parsed_our_type, constrainee=constrainee
-            )
+            )  # type: Tuple[Optional[OurType], Optional[List[Error]]]
             if parsing_errors is not None:
-                underlying_errors.append(
-                    Error(
-                        parsed_our_type.node,
-                        f"Failed to translate "
-                        f"the constrained primitive {parsed_our_type.name}",
-                        parsing_errors,
-                    )
+                return None, Error(
+                    parsed_our_type.node,
+                    f"Failed to translate "
+                    f"the constrained primitive {parsed_our_type.name}",
+                    parsing_errors,
                 )
-                continue
 
         elif isinstance(parsed_our_type, parse.Enumeration):
             our_type, our_type_errors = _to_enumeration(parsed=parsed_our_type)
             if our_type_errors is not None:
-                underlying_errors.append(
-                    Error(
-                        parsed_our_type.node,
-                        f"Failed to translate the enumeration {parsed_our_type.name!r}",
-                        our_type_errors,
-                    )
+                return None, Error(
+                    parsed_our_type.node,
+                    f"Failed to translate the enumeration {parsed_our_type.name!r}",
+                    our_type_errors,
                 )
-                continue
 
         elif isinstance(parsed_our_type, (parse.AbstractClass, parse.ConcreteClass)):
             our_type, our_type_errors = _to_class(
@@ -4634,18 +4629,40 @@ def translate(
             )
 
             if our_type_errors is not None:
-                underlying_errors.append(
-                    Error(
-                        parsed_our_type.node,
-                        f"Failed to translate the class {parsed_our_type.name!r}",
-                        our_type_errors,
-                    )
+                return None, Error(
+                    parsed_our_type.node,
+                    f"Failed to translate the class {parsed_our_type.name!r}",
+                    our_type_errors,
                 )
-                continue
 
         else:
             assert_never(parsed_our_type)
 
+        assert our_type is not None
+        return our_type, None
+
+    # NOTE (mristin, 2022-06-11):
+    # The first-pass translations are independent of each other since all
+    # the references between our types are modelled as placeholders and
+    # resolved only in the second passes. We can therefore schedule them over
+    # a thread pool. A process pool would not pay off here as the parsed
+    # types reference the AST nodes which would have to be pickled for every
+    # single type.
+    #
+    # The results are collected in the original order so that both
+    # the resulting symbol table and the reported errors remain
+    # deterministic.
+    with concurrent.futures.ThreadPoolExecutor() as executor:
+        translation_results = list(
+            executor.map(translate_our_type, parsed_symbol_table.our_types)
+        )
+
+    our_types = []  # type: List[OurType]
+    for our_type, translation_error in translation_results:
+        if translation_error is not None:
+            underlying_errors.append(translation_error)
+            continue
+
         assert our_type is not None
         our_types.append(our_type)
 
@@ -87,9 +87,23 @@ assert (
 # fmt: on
 
 
+# NOTE (mristin, 2022-07-12):
+# We define ``__slots__`` on all the classes of the symbol table so that
+# the instances are laid out compactly and the attribute access is fast.
+# Symbol tables of realistic meta-models contain tens of thousands of these
+# nodes, so the compact layout is worthwhile.
+#
+# Mind that the classes inheriting from :py:class:`icontract.DBC` still carry
+# an instance ``__dict__`` since the base class does not define ``__slots__``
+# itself. The slots nevertheless keep that dictionary empty and guard against
+# accidental attribute assignments.
+
+
 class TypeAnnotation(DBC):
     """Represent a general type annotation."""
 
+    __slots__ = ("parsed",)
+
     #: Relation to the parse stage
     parsed: Final[parse.TypeAnnotation]
 
@@ -106,6 +120,8 @@ class TypeAnnotation(DBC):
 class PrimitiveTypeAnnotation(TypeAnnotation):
     """Represent a primitive type such as ``int``."""
 
+    __slots__ = ("a_type",)
+
     def __init__(self, a_type: PrimitiveType, parsed: parse.TypeAnnotation) -> None:
         """Initialize with the given values."""
         TypeAnnotation.__init__(self, parsed=parsed)
@@ -122,6 +138,8 @@ class OurTypeAnnotation(TypeAnnotation):
      For example, ``Asset``.
     """
 
+    __slots__ = ("our_type",)
+
     def __init__(self, our_type: "OurType", parsed: parse.TypeAnnotation) -> None:
         """Initialize with the given values."""
         TypeAnnotation.__init__(self, parsed=parsed)
@@ -134,6 +152,8 @@ class OurTypeAnnotation(TypeAnnotation):
 class ListTypeAnnotation(TypeAnnotation):
     """Represent a type annotation involving a ``List[...]``."""
 
+    __slots__ = ("items",)
+
     def __init__(self, items: "TypeAnnotationUnion", parsed: parse.TypeAnnotation):
         TypeAnnotation.__init__(self, parsed=parsed)
 
@@ -151,6 +171,8 @@ class ListTypeAnnotation(TypeAnnotation):
 class OptionalTypeAnnotation(TypeAnnotation):
     """Represent a type annotation involving an ``Optional[...]``."""
 
+    __slots__ = ("value",)
+
     def __init__(self, value: "TypeAnnotationUnion", parsed: parse.TypeAnnotation):
         TypeAnnotation.__init__(self, parsed=parsed)
 
@@ -255,6 +277,8 @@ def find_first_field_list(
 class SummaryRemarksDescription(DBC):
     """Represent a description with a summary and remarks."""
 
+    __slots__ = ("summary", "remarks", "parsed")
+
     #: Summary as the first line of the docstring
     summary: Final[docutils.nodes.paragraph]
 
@@ -300,6 +324,8 @@ class SummaryRemarksDescription(DBC):
 class SummaryRemarksConstraintsDescription(SummaryRemarksDescription):
     """Represent a description with summary, remarks and constraints blocks."""
 
+    __slots__ = ("constraints_by_identifier",)
+
     #: Map constraint documentation elements by their identifiers
     constraints_by_identifier: Final[OrderedDict[str, docutils.nodes.field_body]]
 
@@ -330,6 +356,8 @@ class SummaryRemarksConstraintsDescription(SummaryRemarksDescription):
 class DescriptionOfMetaModel(SummaryRemarksConstraintsDescription):
     """Represent a description of a meta-model."""
 
+    __slots__ = ()
+
     def __repr__(self) -> str:
         """Represent the instance as a string for easier debugging."""
         return f"<{_MODULE_NAME}.{self.__class__.__name__} at 0x{id(self):x}>"
@@ -338,6 +366,8 @@ class DescriptionOfMetaModel(SummaryRemarksConstraintsDescription):
 class DescriptionOfOurType(SummaryRemarksConstraintsDescription):
     """Represent a description of our type."""
 
+    __slots__ = ()
+
     def __repr__(self) -> str:
         """Represent the instance as a string for easier debugging."""
         return f"<{_MODULE_NAME}.{self.__class__.__name__} at 0x{id(self):x}>"
@@ -346,6 +376,8 @@ class DescriptionOfOurType(SummaryRemarksConstraintsDescription):
 class DescriptionOfProperty(SummaryRemarksConstraintsDescription):
     """Represent a documentation of a property."""
 
+    __slots__ = ()
+
     def __repr__(self) -> str:
         """Represent the instance as a string for easier debugging."""
         return f"<{_MODULE_NAME}.{self.__class__.__name__} at 0x{id(self):x}>"
@@ -354,6 +386,8 @@ class DescriptionOfProperty(SummaryRemarksConstraintsDescription):
 class DescriptionOfEnumerationLiteral(SummaryRemarksDescription):
     """Represent a documentation of an enumeration literal."""
 
+    __slots__ = ()
+
     def __repr__(self) -> str:
         """Represent the instance as a string for easier debugging."""
         return f"<{_MODULE_NAME}.{self.__class__.__name__} at 0x{id(self):x}>"
@@ -362,6 +396,8 @@ class DescriptionOfEnumerationLiteral(SummaryRemarksDescription):
 class DescriptionOfSignature(SummaryRemarksDescription):
     """Represent a documentation of a method or a function signature."""
 
+    __slots__ = ("arguments_by_name", "returns")
+
     #: Map argument documentation by the argument names
     arguments_by_name: Final[OrderedDict[Identifier, docutils.nodes.field_body]]
 
@@ -407,6 +443,8 @@ class DescriptionOfSignature(SummaryRemarksDescription):
 class DescriptionOfConstant(SummaryRemarksDescription):
     """Represent a documentation of a constant in the meta-model."""
 
+    __slots__ = ()
+
     def __repr__(self) -> str:
         """Represent the instance as a string for easier debugging."""
         return f"<{_MODULE_NAME}.{self.__class__.__name__} at 0x{id(self):x}>"
@@ -420,6 +458,8 @@ class DescriptionOfConstant(SummaryRemarksDescription):
 class Property:
     """Represent a property of a class."""
 
+    __slots__ = ("name", "type_annotation", "description", "specified_for", "parsed")
+
     #: Name of the property
     name: Final[Identifier]
 
@@ -463,6 +503,8 @@ class Property:
 class DefaultPrimitive:
     """Represent a primitive value as a default for an argument."""
 
+    __slots__ = ("value", "parsed")
+
     #: The default value
     value: Final[Union[bool, int, float, str, None]]
 
@@ -480,6 +522,8 @@ class DefaultPrimitive:
 class DefaultEnumerationLiteral:
     """Represent an enumeration literal as a default for an argument."""
 
+    __slots__ = ("parsed", "enumeration", "literal")
+
     #: Related enumeration
     enumeration: Final["Enumeration"]
 
@@ -514,6 +558,8 @@ Default = Union[DefaultPrimitive, DefaultEnumerationLiteral]
 class Argument:
     """Represent an argument of a method (both of an interface and of class)."""
 
+    __slots__ = ("name", "type_annotation", "default", "parsed")
+
     #: Name of the argument
     name: Final[Identifier]
 
@@ -543,6 +589,8 @@ class Argument:
 class Serialization:
     """Specify the general settings for serialization of an interface or a class."""
 
+    __slots__ = ("with_model_type",)
+
     def __init__(self, with_model_type: bool) -> None:
         """
         Initialize with the given values.
@@ -556,6 +604,8 @@ class Serialization:
 class ReferenceInTheBook:
     """Represent the information indicated in the ``reference_in_the_book`` marker."""
 
+    __slots__ = ("section", "index", "fragment")
+
     #: Section number
     section: Final[Tuple[int, ...]]
 
@@ -579,6 +629,8 @@ class ReferenceInTheBook:
 class Invariant:
     """Represent an invariant of a class."""
 
+    __slots__ = ("description", "body", "specified_for", "parsed")
+
     #: Human-readable description of the invariant, if any
     description: Final[Optional[str]]
 
@@ -610,6 +662,8 @@ class Invariant:
 class Contract:
     """Represent a contract of a method."""
 
+    __slots__ = ("args", "description", "body", "parsed")
+
     #: Argument names of the contract
     args: Final[Sequence[Identifier]]
 
@@ -639,6 +693,8 @@ class Contract:
 class Snapshot:
     """Represent a snapshot of an OLD value capture before the method execution."""
 
+    __slots__ = ("args", "body", "name", "parsed")
+
     #: Argument names of the snapshot
     args: Final[Sequence[Identifier]]
 
@@ -668,6 +724,8 @@ class Snapshot:
 class Contracts:
     """Represent the set of contracts for a method or a function."""
 
+    __slots__ = ("preconditions", "snapshots", "postconditions")
+
     # NOTE (mristin, 2022-04-07):
     # Common programming languages which work with contracts usually implement
     # pre-conditions in a disjunctive normal form, *i.e.* as a disjunction of
@@ -709,6 +767,16 @@ class SignatureLike(DBC):
     This can be either a signature of a method, a method or a function.
     """
 
+    __slots__ = (
+        "name",
+        "arguments",
+        "returns",
+        "description",
+        "contracts",
+        "parsed",
+        "arguments_by_name",
+    )
+
     #: Name of the signature-like
     name: Final[Identifier]
 
@@ -794,6 +862,8 @@ class SignatureLike(DBC):
 class Method(SignatureLike):
     """Represent a method of a class."""
 
+    __slots__ = ("specified_for",)
+
     # NOTE (mristin, 2021-12-26):
     # The ``parsed`` must be optional in the parent class, ``SignatureLike``, since
     # constructors can be synthesized without being defined in the original meta-model.
@@ -879,6 +949,8 @@ class Method(SignatureLike):
 class ImplementationSpecificMethod(Method):
     """Represent an implementation-specific method of a class."""
 
+    __slots__ = ()
+
     # NOTE (mristin, 2021-12-26):
     # The ``parsed`` must be optional in the parent class, ``SignatureLike``, since
     # constructors can be synthesized without being defined in the original meta-model.
@@ -899,6 +971,8 @@ class ImplementationSpecificMethod(Method):
 class UnderstoodMethod(Method):
     """Represent a method of a class which we could understand."""
 
+    __slots__ = ("body",)
+
     #: Understood syntax tree of the method's body
     body: Final[Sequence[parse_tree.Node]]
 
@@ -951,6 +1025,8 @@ class Constructor(SignatureLike):
     The constructor is expected to be stacked from the class and all the ancestors.
     """
 
+    __slots__ = ("is_implementation_specific", "statements")
+
     #: Interpreted statements of the constructor, stacked over all the ancestors
     statements: Final[Sequence[construction.AssignArgument]]
 
@@ -990,6 +1066,8 @@ class Constructor(SignatureLike):
 class EnumerationLiteral:
     """Represent a single enumeration literal."""
 
+    __slots__ = ("name", "value", "description", "parsed")
+
     def __init__(
         self,
         name: Identifier,
@@ -1021,6 +1099,16 @@ class EnumerationLiteral:
 class Enumeration:
     """Represent an enumeration."""
 
+    __slots__ = (
+        "name",
+        "literals",
+        "reference_in_the_book",
+        "description",
+        "parsed",
+        "literals_by_name",
+        "literal_id_set",
+    )
+
     #: Name of the enumeration
     name: Final[Identifier]
 
@@ -1069,6 +1157,20 @@ class Enumeration:
 class ConstrainedPrimitive:
     """Represent a primitive type constrained by one or more invariants."""
 
+    __slots__ = (
+        "name",
+        "constrainee",
+        "is_implementation_specific",
+        "reference_in_the_book",
+        "description",
+        "parsed",
+        "_descendant_id_set",
+        "_invariants",
+        "_invariant_id_set",
+        "_inheritances",
+        "_inheritance_id_set",
+    )
+
     #: Name of the class
     name: Final[Identifier]
 
@@ -1245,6 +1347,28 @@ class ConstrainedPrimitive:
 class Class(DBC):
     """Represent an abstract or a concrete class."""
 
+    __slots__ = (
+        "name",
+        "interface",
+        "is_implementation_specific",
+        "constructor",
+        "serialization",
+        "reference_in_the_book",
+        "description",
+        "parsed",
+        "_inheritances",
+        "_inheritance_id_set",
+        "_descendant_id_set",
+        "_concrete_descendants",
+        "_properties",
+        "_properties_by_name",
+        "_property_id_set",
+        "_methods",
+        "_methods_by_name",
+        "_invariants",
+        "_invariant_id_set",
+    )
+
     #: Name of the class
     name: Final[Identifier]
 
@@ -1535,6 +1659,8 @@ class Class(DBC):
 class ConcreteClass(Class):
     """Represent a class that can be instantiated."""
 
+    __slots__ = ()
+
     def __repr__(self) -> str:
         """Represent the instance as a string for easier debugging."""
         return (
@@ -1545,6 +1671,8 @@ class ConcreteClass(Class):
 class AbstractClass(Class):
     """Represent a class that is purely abstract and can not be instantiated."""
 
+    __slots__ = ()
+
     #: Interface of the class. All abstract classes have an interface as opposed to
     #: concrete classes, which only have an interface if there are descendants.
     interface: "Interface"
@@ -1600,6 +1728,8 @@ class AbstractClass(Class):
 class Constant(DBC):
     """Represent a constant of the meta-model."""
 
+    __slots__ = ("name", "reference_in_the_book", "description")
+
     #: Name of the constant
     name: Final[Identifier]
 
@@ -1629,6 +1759,8 @@ class Constant(DBC):
 class ConstantPrimitive(Constant):
     """Represent a constant primitive value in the meta-model."""
 
+    __slots__ = ("value", "a_type", "parsed")
+
     #: Value of the constant
     value: Union[bool, int, float, str, bytearray]
 
@@ -1676,6 +1808,8 @@ class ConstantPrimitive(Constant):
 class PrimitiveSetLiteral:
     """Represent an item of a set of primitive literals."""
 
+    __slots__ = ("value", "a_type", "parsed")
+
     #: Value of the literal
     value: Union[bool, int, float, str, bytearray]
 
@@ -1714,6 +1848,8 @@ class PrimitiveSetLiteral:
 class ConstantSetOfPrimitives(Constant):
     """Represent a set of primitive literals."""
 
+    __slots__ = ("a_type", "literals", "subsets", "parsed", "literal_value_set")
+
     #: Type of the literals
     a_type: Final[PrimitiveType]
 
@@ -1787,6 +1923,8 @@ class ConstantSetOfPrimitives(Constant):
 class ConstantSetOfEnumerationLiterals(Constant):
     """Represent a set of enumeration literals."""
 
+    __slots__ = ("enumeration", "literals", "subsets", "parsed", "literal_id_set")
+
     #: Enumeration that this is a subset of
     enumeration: Final[Enumeration]
 
@@ -1860,6 +1998,8 @@ class ConstantSetOfEnumerationLiterals(Constant):
 class Verification(SignatureLike):
     """Represent a verification function defined in the meta-model."""
 
+    __slots__ = ()
+
     parsed: parse.Method
 
     # fmt: off
@@ -1916,6 +2056,8 @@ class Verification(SignatureLike):
 class ImplementationSpecificVerification(Verification):
     """Represent an implementation-specific verification function."""
 
+    __slots__ = ()
+
     def __init__(
         self,
         name: Identifier,
@@ -1951,6 +2093,8 @@ class PatternVerification(Verification):
     The function is expected to return a boolean.
     """
 
+    __slots__ = ("pattern",)
+
     #: Method as we understood it in the parse stage
     parsed: parse.UnderstoodMethod
 
@@ -2011,6 +2155,8 @@ class TranspilableVerification(Verification):
     Nevertheless, we can still transpile it into different target implementations.
     """
 
+    __slots__ = ()
+
     #: Method as we understood it in the parse stage
     parsed: parse.UnderstoodMethod
 
@@ -2047,6 +2193,8 @@ class TranspilableVerification(Verification):
 class Signature(SignatureLike):
     """Represent a signature of a method in an interface."""
 
+    __slots__ = ()
+
     def __init__(
         self,
         name: Identifier,
@@ -2089,6 +2237,19 @@ class Interface:
     targets where multiple inheritance is not supported.
     """
 
+    __slots__ = (
+        "base",
+        "name",
+        "inheritances",
+        "implementers",
+        "properties",
+        "signatures",
+        "description",
+        "parsed",
+        "properties_by_name",
+        "property_id_set",
+    )
+
     #: Class which this interface is based on
     base: Final[Class]
 
@@ -2173,6 +2334,8 @@ T = TypeVar("T")
 class MetaModel:
     """Collect information about the underlying meta-model."""
 
+    __slots__ = ("book_url", "book_version", "description")
+
     #: Description of the meta-model extracted from the docstring
     description: Final[Optional[DescriptionOfMetaModel]]
 
@@ -2196,6 +2359,17 @@ class MetaModel:
 class SymbolTable:
     """Represent all the symbols of the intermediate representation."""
 
+    __slots__ = (
+        "our_types",
+        "our_types_topologically_sorted",
+        "constants",
+        "verification_functions",
+        "meta_model",
+        "constants_by_name",
+        "verification_functions_by_name",
+        "_name_to_our_type",
+    )
+
     #: List of all our types that we need for the code generation
     our_types: Final[Sequence["OurType"]]
 
@@ -2529,6 +2703,8 @@ def map_descendability(
 class _ConstructorArgumentOfClass:
     """Represent a constructor argument with its corresponding class."""
 
+    __slots__ = ("arg", "cls")
+
     def __init__(self, arg: Argument, cls: Class) -> None:
         """Initialize with the given values."""
         self.arg = arg
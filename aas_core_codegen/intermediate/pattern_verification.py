@@ -8,7 +8,7 @@ defined in :py:mod:`aas_core_codegen.intermediate._types` to avoid circular impo
 """
 import collections
 import re
-from typing import Optional, Tuple, List, MutableMapping, Mapping
+from typing import Optional, Tuple, List, MutableMapping
 
 from icontract import require, ensure
 
@@ -17,14 +17,28 @@ from aas_core_codegen.common import Error, Identifier, assert_never
 from aas_core_codegen.parse import tree as parse_tree
 
 
-def _check_support(
-    node: parse_tree.Node, argument: Identifier
-) -> Optional[List[Error]]:
+# NOTE (mristin, 2022-07-12):
+# We used to check the support for the constructs in one traversal of the function
+# body and re-execute the body in a second traversal to infer the pattern. Since
+# the checks and the evaluation visit exactly the same nodes, we fused them into
+# a single traversal so that the body is walked only once per verification
+# function. The evaluation keeps the pattern in the end cached on
+# :py:class:`aas_core_codegen.intermediate._types.PatternVerification`, so no
+# generator ever needs to re-walk the body to obtain the pattern.
+
+
+@ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
+def _check_and_evaluate(
+    node: parse_tree.Node, argument: Identifier, state: MutableMapping[Identifier, str]
+) -> Tuple[Optional[str], Optional[List[Error]]]:
     """
-    Check that we understand the ``node`` in the pattern-matching function.
+    Evaluate the ``node`` of the pattern-matching function to a string constant.
 
     The ``argument`` specifies the argument to the verification function, which should
-    not be used.
+    not be used. If the ``node`` is an assignment, the evaluated value is also stored
+    in the ``state``.
+
+    :return: the evaluated value, or the errors if we do not understand the ``node``
     """
     # NOTE (mristin, 2021-12-19):
     # This run-time check is necessary as we already burned our fingers with it.
@@ -32,9 +46,9 @@ def _check_support(
 
     if isinstance(node, parse_tree.Constant):
         if isinstance(node.value, str):
-            return None
+            return node.value, None
         else:
-            return [
+            return None, [
                 Error(
                     node.original_node,
                     f"We did not implement the support for non-string constants "
@@ -46,38 +60,54 @@ def _check_support(
 
     elif isinstance(node, parse_tree.JoinedStr):
         errors = []  # type: List[Error]
+        parts = []  # type: List[str]
 
         for value in node.values:
             # noinspection PyTypeChecker
             if isinstance(value, str):
-                continue
+                parts.append(value)
             elif isinstance(value, parse_tree.FormattedValue):
-                underlying_errors = _check_support(node=value.value, argument=argument)
+                part, underlying_errors = _check_and_evaluate(
+                    node=value.value, argument=argument, state=state
+                )
                 if underlying_errors is not None:
                     errors.extend(underlying_errors)
+                else:
+                    assert part is not None
+                    parts.append(part)
             else:
                 assert_never(value)
 
-        if len(errors) == 0:
-            return None
+        if len(errors) > 0:
+            return None, errors
 
-        return errors
+        return "".join(parts), None
 
     elif isinstance(node, parse_tree.Name):
         if node.identifier == argument:
-            return [
+            return None, [
                 Error(
                     node.original_node,
                     f"The verification arguments, {argument!r}, is not expected "
                     f"to be accessed neither for reading nor for writing.",
                 )
             ]
-        else:
-            return None
+
+        value = state.get(node.identifier, None)
+        if value is None:
+            return None, [
+                Error(
+                    node.original_node,
+                    f"The value of variable {node.identifier} has not been assigned "
+                    f"before",
+                )
+            ]
+
+        return value, None
 
     elif isinstance(node, parse_tree.Assignment):
         if not isinstance(node.target, parse_tree.Name):
-            return [
+            return None, [
                 Error(
                     node.target.original_node,
                     f"We currently support only assignments to simple variables, "
@@ -87,10 +117,19 @@ def _check_support(
                 )
             ]
 
-        return _check_support(node=node.value, argument=argument)
+        value, errors = _check_and_evaluate(
+            node=node.value, argument=argument, state=state
+        )
+        if errors is not None:
+            return None, errors
+
+        assert value is not None
+        state[node.target.identifier] = value
+
+        return value, None
 
     else:
-        return [
+        return None, [
             Error(
                 node.original_node,
                 f"We did not implement the support for this construct "
@@ -101,52 +140,6 @@ def _check_support(
         ]
 
 
-@ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
-def _evaluate(
-    expr: parse_tree.Expression, state: Mapping[Identifier, str]
-) -> Tuple[Optional[str], Optional[Error]]:
-    """Evaluate the expression to a string constant."""
-    if isinstance(expr, parse_tree.Constant):
-        assert isinstance(expr.value, str)
-        return expr.value, None
-
-    elif isinstance(expr, parse_tree.Name):
-        value = state.get(expr.identifier, None)
-        if value is None:
-            return (
-                None,
-                Error(
-                    expr.original_node,
-                    f"The value of variable {expr.identifier} has not been assigned "
-                    f"before",
-                ),
-            )
-
-        return value, None
-
-    elif isinstance(expr, parse_tree.JoinedStr):
-        parts = []  # type: List[str]
-        for joined_str_value in expr.values:
-            if isinstance(joined_str_value, str):
-                parts.append(joined_str_value)
-
-            elif isinstance(joined_str_value, parse_tree.FormattedValue):
-
-                part, error = _evaluate(joined_str_value.value, state=state)
-                if error is not None:
-                    return None, error
-
-                assert part is not None
-                parts.append(part)
-            else:
-                assert_never(joined_str_value)
-
-        return "".join(parts), None
-
-    else:
-        raise AssertionError(f"Unexpected expression: {parse_tree.dump(expr)}")
-
-
 # fmt: off
 @require(
     lambda parsed:
@@ -350,7 +343,9 @@ def try_to_understand(
             ),
         )
 
-    # region Check the support of the statements
+    # region Check the statements and re-execute them to infer the pattern
+
+    state = collections.OrderedDict()  # type: MutableMapping[Identifier, str]
 
     errors = []  # type: List[Error]
     for i, stmt in enumerate(parsed.body):
@@ -358,13 +353,15 @@ def try_to_understand(
         if i == len(parsed.body) - 1:
             break
 
-        underlying_errors = _check_support(node=stmt, argument=parsed.arguments[0].name)
+        _, underlying_errors = _check_and_evaluate(
+            node=stmt, argument=parsed.arguments[0].name, state=state
+        )
 
         if underlying_errors is not None:
             errors.extend(underlying_errors)
 
-    underlying_errors = _check_support(
-        node=match_call.args[0], argument=parsed.arguments[0].name
+    pattern, underlying_errors = _check_and_evaluate(
+        node=match_call.args[0], argument=parsed.arguments[0].name, state=state
     )
 
     if underlying_errors is not None:
@@ -384,33 +381,6 @@ def try_to_understand(
 
     # endregion
 
-    # region Re-execute the function to infer the pattern
-
-    state = collections.OrderedDict()  # type: MutableMapping[Identifier, str]
-
-    pattern = None  # type: Optional[str]
-    for i, stmt in enumerate(parsed.body):
-        if i < len(parsed.body) - 1:
-            assert isinstance(stmt, parse_tree.Assignment)
-            assert isinstance(stmt.target, parse_tree.Name)
-
-            value, error = _evaluate(expr=stmt.value, state=state)
-            if error is not None:
-                return None, None, error
-
-            assert value is not None
-
-            state[stmt.target.identifier] = value
-
-        else:
-            pattern, error = _evaluate(expr=match_call.args[0], state=state)
-            if error is not None:
-                return None, None, error
-
-            assert pattern is not None
-
-    # endregion
-
     assert pattern is not None
 
     try:
@@ -1,6 +1,7 @@
 """Generate JSON schema corresponding to the meta-model."""
 import collections
 import json
+import textwrap
 from typing import (
     TextIO,
     Any,
@@ -22,7 +23,7 @@ from aas_core_codegen import (
     run,
     infer_for_schema,
 )
-from aas_core_codegen.common import Stripped, Error, assert_never, Identifier
+from aas_core_codegen.common import Error, assert_never, Identifier
 
 assert aas_core_codegen.jsonschema.__doc__ == __doc__
 
@@ -352,12 +353,112 @@ def _define_for_class(
     return result, None
 
 
+def _dump_definition(definition: Any, compact: bool) -> str:
+    """
+    Serialize the ``definition`` as a fragment beneath ``definitions``.
+
+    If not ``compact``, the fragment is indented as if it were nested in
+    the complete schema so that the caller can simply concatenate
+    the fragments.
+    """
+    if compact:
+        return json.dumps(definition, separators=(",", ":"))
+
+    dumped = json.dumps(definition, indent=2)
+
+    # NOTE (mristin, 2022-06-11):
+    # The fragment lives at the second level of nesting in the schema. We do
+    # not indent the first line since the caller prefixes it with
+    # the definition name.
+    return textwrap.indent(dumped, "    ")[4:]
+
+
+@ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
+def _parse_options(
+    spec_impls: specific_implementations.SpecificImplementations,
+) -> Tuple[Optional[bool], Optional[Error]]:
+    """
+    Parse the ``jsonschema`` section of the optional ``options.json`` snippet.
+
+    The snippet is shared among all the targets, so the options live in
+    per-target sections, *e.g.*, ``{"jsonschema": {"compact": true}}``.
+    The sections of the other targets are deliberately ignored here — each
+    target validates only its own section.
+
+    :return: whether the schema should be serialized compactly, or the error
+    """
+    options_key = specific_implementations.ImplementationKey("options.json")
+
+    options_json = spec_impls.get(options_key, None)
+    if options_json is None:
+        return False, None
+
+    try:
+        options = json.loads(options_json)
+    except json.JSONDecodeError as err:
+        return None, Error(
+            None, f"Failed to parse the options from {options_key}: {err}"
+        )
+
+    if not isinstance(options, dict):
+        return None, Error(
+            None,
+            f"Expected the options at {options_key} to be a JSON object, "
+            f"but got: {type(options)}",
+        )
+
+    section = options.get("jsonschema", None)
+    if section is None:
+        return False, None
+
+    if not isinstance(section, dict):
+        return None, Error(
+            None,
+            f"Expected the ``jsonschema`` section of the options "
+            f"at {options_key} to be a JSON object, but got: {type(section)}",
+        )
+
+    unexpected_keys = sorted(set(section.keys()) - {"compact"})
+    if len(unexpected_keys) > 0:
+        return None, Error(
+            None,
+            f"Unexpected properties in the ``jsonschema`` section of the options "
+            f"at {options_key}: {unexpected_keys}",
+        )
+
+    compact = section.get("compact", False)
+    if not isinstance(compact, bool):
+        return None, Error(
+            None,
+            f"Expected the property ``compact`` in the ``jsonschema`` section "
+            f"of the options at {options_key} to be a boolean, "
+            f"but got: {type(compact)}",
+        )
+
+    return compact, None
+
+
 @ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
 def _generate(
     symbol_table: intermediate.SymbolTable,
     spec_impls: specific_implementations.SpecificImplementations,
-) -> Tuple[Optional[Stripped], Optional[List[Error]]]:
-    """Generate the JSON schema based on the ``symbol_table."""
+    constraints_by_class: MutableMapping[
+        intermediate.ClassUnion, infer_for_schema.ConstraintsByProperty
+    ],
+) -> Tuple[Optional[List[str]], Optional[List[Error]]]:
+    """
+    Generate the JSON schema based on the ``symbol_table``.
+
+    The schema is returned as a list of chunks which the caller is expected
+    to write to the output in order. Each definition is serialized to its
+    chunk as soon as it is generated so that the whole schema never needs to
+    live in memory as nested mappings. The definitions are emitted sorted by
+    name, so the output remains stable across the runs and is cheap to diff.
+
+    If the optional snippet ``options.json`` sets ``compact`` to true in its
+    ``jsonschema`` section, the schema is serialized without indentation for
+    machine consumers.
+    """
     schema_base_key = specific_implementations.ImplementationKey("schema_base.json")
 
     schema_base_json = spec_impls.get(schema_base_key, None)
@@ -392,21 +493,16 @@ def _generate(
             )
         ]
 
-    errors = []  # type: List[Error]
-
-    definitions = collections.OrderedDict()
+    compact, options_error = _parse_options(spec_impls=spec_impls)
+    if options_error is not None:
+        return None, [options_error]
 
-    constraints_by_class, some_errors = infer_for_schema.infer_constraints_by_class(
-        symbol_table=symbol_table
-    )
-
-    if some_errors is not None:
-        errors.extend(some_errors)
+    assert compact is not None
 
-    if len(errors) > 0:
-        return None, errors
+    errors = []  # type: List[Error]
 
-    assert constraints_by_class is not None
+    # Definition name -> serialized definition
+    definitions = dict()  # type: MutableMapping[str, str]
 
     ids_of_our_types_in_properties = (
         intermediate.collect_ids_of_our_types_in_properties(symbol_table=symbol_table)
@@ -505,7 +601,9 @@ def _generate(
                 )
                 continue
             else:
-                definitions[identifier] = definition
+                definitions[identifier] = _dump_definition(
+                    definition=definition, compact=compact
+                )
 
     if len(errors) > 0:
         return None, errors
@@ -519,21 +617,71 @@ def _generate(
         )
     ]  # type: List[Identifier]
 
-    definitions["ModelType"] = collections.OrderedDict(
-        [("type", "string"), ("enum", model_types)]
+    definitions["ModelType"] = _dump_definition(
+        definition=collections.OrderedDict([("type", "string"), ("enum", model_types)]),
+        compact=compact,
     )
 
-    schema["definitions"] = collections.OrderedDict(
-        [(name, definitions[name]) for name in sorted(definitions.keys())]
+    base_text = (
+        json.dumps(schema, separators=(",", ":"))
+        if compact
+        else json.dumps(schema, indent=2)
     )
 
-    return Stripped(json.dumps(schema, indent=2)), None
+    chunks = []  # type: List[str]
+
+    if compact:
+        if len(schema) > 0:
+            assert base_text.endswith("}")
+            chunks.append(base_text[:-1] + ',"definitions":{')
+        else:
+            chunks.append('{"definitions":{')
+
+        for i, name in enumerate(sorted(definitions.keys())):
+            if i > 0:
+                chunks.append(",")
+            chunks.append(f"{json.dumps(name)}:{definitions[name]}")
+
+        chunks.append("}}")
+    else:
+        if len(schema) > 0:
+            assert base_text.endswith("\n}")
+            chunks.append(base_text[:-2] + ',\n  "definitions": {\n')
+        else:
+            chunks.append('{\n  "definitions": {\n')
+
+        for i, name in enumerate(sorted(definitions.keys())):
+            if i > 0:
+                chunks.append(",\n")
+            chunks.append(f"    {json.dumps(name)}: {definitions[name]}")
+
+        chunks.append("\n  }\n}")
+
+    return chunks, None
 
 
 def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
     """Generate the code."""
-    code, errors = _generate(
-        symbol_table=context.symbol_table, spec_impls=context.spec_impls
+    # NOTE (mristin, 2022-07-12):
+    # The constraint inference is shared over the context so that the schema
+    # targets do not infer the same constraints thrice in a multi-target run.
+    constraints_by_class, errors = context.infer_constraints_by_class()
+
+    if errors is not None:
+        run.write_error_report(
+            message=f"Failed to infer the constraints for the JSON Schema "
+            f"based on {context.model_path}",
+            errors=[context.lineno_columner.error_message(error) for error in errors],
+            stderr=stderr,
+        )
+        return 1
+
+    assert constraints_by_class is not None
+
+    chunks, errors = _generate(
+        symbol_table=context.symbol_table,
+        spec_impls=context.spec_impls,
+        constraints_by_class=constraints_by_class,
     )
 
     if errors is not None:
@@ -545,11 +693,11 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
         )
         return 1
 
-    assert code is not None
+    assert chunks is not None
 
     pth = context.output_dir / "schema.json"
     try:
-        pth.write_text(code, encoding="utf-8")
+        run.write_if_different(pth, chunks)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the JSON schema to {pth}",
@@ -2,12 +2,36 @@
 
 import argparse
 import enum
+import hashlib
+import io
+import multiprocessing
 import pathlib
+import queue
 import sys
-from typing import TextIO
+import tarfile
+import tempfile
+import time
+from typing import (
+    List,
+    Mapping,
+    MutableMapping,
+    Optional,
+    Sequence,
+    TextIO,
+    Tuple,
+)
+
+from icontract import require
 
 import aas_core_codegen
-from aas_core_codegen import parse, run, specific_implementations, intermediate
+from aas_core_codegen import (
+    caching,
+    parse,
+    profiling,
+    run,
+    specific_implementations,
+    intermediate,
+)
 from aas_core_codegen.common import LinenoColumner, assert_never
 import aas_core_codegen.csharp.main as csharp_main
 import aas_core_codegen.jsonschema.main as jsonschema_main
@@ -29,23 +53,371 @@ class Target(enum.Enum):
 class Parameters:
     """Represent the program parameters."""
 
+    # fmt: off
+    @require(
+        lambda target, targets:
+        (target is None) ^ (targets is None),
+        "Either a single target or a list of targets, but not both"
+    )
+    @require(
+        lambda targets:
+        targets is None or len(targets) > 0
+    )
+    @require(
+        lambda output_dir, output_bundle:
+        (output_dir is None) ^ (output_bundle is None),
+        "Either an output directory or an output bundle, but not both"
+    )
+    # fmt: on
     def __init__(
         self,
         model_path: pathlib.Path,
-        target: Target,
         snippets_dir: pathlib.Path,
-        output_dir: pathlib.Path,
+        output_dir: Optional[pathlib.Path] = None,
+        target: Optional[Target] = None,
+        targets: Optional[Sequence[Target]] = None,
+        cache_dir: Optional[pathlib.Path] = None,
+        profile: bool = False,
+        output_bundle: Optional[pathlib.Path] = None,
     ) -> None:
         """Initialize with the given values."""
         self.model_path = model_path
+        self.cache_dir = cache_dir
+        self.profile = profile
         self.target = target
+
+        if targets is not None:
+            self.targets = targets  # type: Sequence[Target]
+        else:
+            assert target is not None
+            self.targets = [target]
+
         self.snippets_dir = snippets_dir
         self.output_dir = output_dir
 
+        #: If set, the generated artifacts are packed as a single tar archive
+        #: at this path instead of being written into an output directory;
+        #: the special path ``-`` designates the standard output
+        self.output_bundle = output_bundle
+
+
+def _execute_target(
+    context: run.Context, target: Target, stdout: TextIO, stderr: TextIO
+) -> int:
+    """Dispatch the generation for the given single ``target``."""
+    if target is Target.CSHARP:
+        return csharp_main.execute(context=context, stdout=stdout, stderr=stderr)
+
+    elif target is Target.JSONSCHEMA:
+        return jsonschema_main.execute(context=context, stdout=stdout, stderr=stderr)
+
+    elif target is Target.RDF_SHACL:
+        return rdf_shacl_main.execute(context=context, stdout=stdout, stderr=stderr)
+
+    elif target is Target.XSD:
+        return xsd_main.execute(context=context, stdout=stdout, stderr=stderr)
+
+    else:
+        assert_never(target)
+
+
+def _execute_target_in_process(
+    context: run.Context,
+    target: Target,
+    result_queue: "multiprocessing.Queue[Tuple[str, int, str, str]]",
+) -> None:
+    """
+    Run a single ``target`` in a worker process.
+
+    The captured standard output and error streams are put on the ``result_queue``
+    together with the exit code so that the parent process can report them
+    deterministically.
+    """
+    stdout = io.StringIO()
+    stderr = io.StringIO()
+
+    exit_code = _execute_target(
+        context=context, target=target, stdout=stdout, stderr=stderr
+    )
+
+    result_queue.put((target.value, exit_code, stdout.getvalue(), stderr.getvalue()))
+
+
+#: Interval, in seconds, at which the parent process checks the liveness of
+#: the worker processes while waiting for their results
+_WORKER_POLL_INTERVAL = 1.0
+
+
+def _execute_targets_in_parallel(
+    context: run.Context, targets: Sequence[Target], stdout: TextIO, stderr: TextIO
+) -> int:
+    """
+    Fan out the generation for the ``targets`` over worker processes.
+
+    The meta-model has been already parsed and translated in ``context``, so
+    the workers share the in-memory symbol table instead of re-doing the parsing
+    and the intermediate translation for each target.
+
+    :return: the first non-zero exit code, or 0 if all the targets succeeded
+    """
+    # NOTE (mristin, 2022-05-02):
+    # We rely on ``fork`` so that the workers inherit the parsed symbol table
+    # without pickling it. On platforms without ``fork`` (*e.g.*, Windows) we
+    # fall back to the sequential execution — the sharing of the context would
+    # otherwise cost us more than the parallelism gains.
+    if "fork" not in multiprocessing.get_all_start_methods():
+        exit_code = 0
+        for target in targets:
+            target_exit_code = _execute_target(
+                context=context, target=target, stdout=stdout, stderr=stderr
+            )
+            if target_exit_code != 0 and exit_code == 0:
+                exit_code = target_exit_code
+
+        return exit_code
+
+    # NOTE (mristin, 2022-07-12):
+    # The schema constraints must be inferred *before* the fork so that the
+    # workers inherit the memoized result. Otherwise, every worker would
+    # re-infer the same constraints independently in its own address space.
+    # The errors, if any, are deliberately ignored here: the workers observe
+    # the same memoized errors and each schema target reports them on its own,
+    # exactly as in a sequential run.
+    context.infer_constraints_by_class()
+
+    mp_context = multiprocessing.get_context("fork")
+
+    result_queue = (
+        mp_context.Queue()
+    )  # type: multiprocessing.Queue[Tuple[str, int, str, str]]
+
+    processes = [
+        mp_context.Process(
+            target=_execute_target_in_process,
+            kwargs=dict(context=context, target=target, result_queue=result_queue),
+        )
+        for target in targets
+    ]
+
+    for process in processes:
+        process.start()
+
+    process_by_target_value = {
+        target.value: process for target, process in zip(targets, processes)
+    }
+
+    results = dict()  # type: MutableMapping[str, Tuple[int, str, str]]
+    pending = {target.value for target in targets}
+
+    while len(pending) > 0:
+        try:
+            target_value, target_exit_code, out_text, err_text = result_queue.get(
+                timeout=_WORKER_POLL_INTERVAL
+            )
+            results[target_value] = (target_exit_code, out_text, err_text)
+            pending.discard(target_value)
+            continue
+        except queue.Empty:
+            pass
+
+        # NOTE (mristin, 2022-07-12):
+        # No result arrived within the poll interval, so check whether one of
+        # the workers died without posting its result (*e.g.*, killed by the
+        # OOM killer or crashed in a C extension). A worker flushes its queue
+        # data to the pipe before it exits, so once its exit code is set and
+        # the queue stayed empty for a whole interval, no result can arrive
+        # from it any more; without this check the parent would block forever.
+        for target_value in sorted(pending):
+            process = process_by_target_value[target_value]
+            if process.exitcode is None:
+                continue
+
+            results[target_value] = (
+                process.exitcode if process.exitcode != 0 else 1,
+                "",
+                f"The worker process for the target {target_value} terminated "
+                f"with the exit code {process.exitcode} "
+                f"without producing a result\n",
+            )
+            pending.discard(target_value)
+
+    for process in processes:
+        process.join()
+
+    exit_code = 0
+
+    # NOTE (mristin, 2022-05-02):
+    # We report in the order of the ``targets``, not in the order of completion,
+    # so that the output remains deterministic.
+    for target in targets:
+        target_exit_code, out_text, err_text = results[target.value]
+
+        stdout.write(out_text)
+        stderr.write(err_text)
+
+        if target_exit_code != 0 and exit_code == 0:
+            exit_code = target_exit_code
+
+    return exit_code
+
+
+def _pack_output_dir_into_bundle(
+    output_dir: pathlib.Path,
+    output_bundle: pathlib.Path,
+    stdout: TextIO,
+    stderr: TextIO,
+) -> int:
+    """
+    Pack all the files beneath ``output_dir`` as a tar archive.
+
+    The archive is streamed to ``output_bundle``, or to the standard output
+    if ``output_bundle`` is ``-``. The files are added in the sorted order of
+    their relative paths so that the archive is deterministic.
+
+    :return: exit code
+    """
+    paths = sorted(
+        pth for pth in output_dir.glob("**/*") if pth.is_file()
+    )  # type: List[pathlib.Path]
+
+    def add_files(tar: tarfile.TarFile) -> None:
+        """Add the ``paths`` to the ``tar``, normalized for reproducibility."""
+        for pth in paths:
+            tar_info = tarfile.TarInfo(name=pth.relative_to(output_dir).as_posix())
+            tar_info.size = pth.stat().st_size
+
+            with pth.open("rb") as fid:
+                tar.addfile(tar_info, fid)
+
+    if str(output_bundle) == "-":
+        buffer = getattr(stdout, "buffer", None)
+        if buffer is None:
+            stderr.write(
+                "The --output_bundle was set to '-', but the standard output "
+                "does not provide a binary buffer to stream the tar archive to.\n"
+            )
+            return 1
+
+        # NOTE (mristin, 2022-07-12):
+        # The mode ``w|`` writes the archive as a non-seekable stream, which is
+        # what a pipe on the standard output expects.
+        with tarfile.open(fileobj=buffer, mode="w|") as tar:
+            add_files(tar)
+    else:
+        try:
+            with tarfile.open(str(output_bundle), mode="w") as tar:
+                add_files(tar)
+        except Exception as exception:
+            run.write_error_report(
+                message=f"Failed to write the output bundle to {output_bundle}",
+                errors=[str(exception)],
+                stderr=stderr,
+            )
+            return 1
+
+        stdout.write(f"Bundle written to: {output_bundle}\n")
+
+    return 0
+
+
+def _parse_and_translate(
+    model_path: pathlib.Path,
+    text: str,
+    stderr: TextIO,
+    profiler: Optional[profiling.Profiler] = None,
+) -> Optional[Tuple[intermediate.SymbolTable, LinenoColumner]]:
+    """
+    Parse the meta-model ``text`` and translate it to the intermediate form.
+
+    The errors, if any, are reported to ``stderr``.
+
+    :return: the translated symbol table and the line/column resolver, or None
+    """
+    # BEFORE-RELEASE (mristin, 2021-12-13):
+    #  test all the following individual failure cases
+    with profiling.measure_if(profiler, "parse.source_to_atok"):
+        atok, parse_exception = parse.source_to_atok(source=text)
+    if parse_exception:
+        if isinstance(parse_exception, SyntaxError):
+            stderr.write(
+                f"Failed to parse the meta-model {model_path}: "
+                f"invalid syntax at line {parse_exception.lineno}\n"
+            )
+        else:
+            stderr.write(
+                f"Failed to parse the meta-model {model_path}: "
+                f"{parse_exception}\n"
+            )
+
+        return None
+
+    import_errors = parse.check_expected_imports(atok=atok)
+    if import_errors:
+        run.write_error_report(
+            message="One or more unexpected imports in the meta-model",
+            errors=import_errors,
+            stderr=stderr,
+        )
+
+        return None
+
+    lineno_columner = LinenoColumner(atok=atok)
+
+    with profiling.measure_if(profiler, "parse.atok_to_symbol_table"):
+        parsed_symbol_table, error = parse.atok_to_symbol_table(atok=atok)
+    if error is not None:
+        run.write_error_report(
+            message=f"Failed to construct the symbol table from {model_path}",
+            errors=[lineno_columner.error_message(error)],
+            stderr=stderr,
+        )
+
+        return None
+
+    assert parsed_symbol_table is not None
+
+    with profiling.measure_if(profiler, "intermediate.translate"):
+        ir_symbol_table, error = intermediate.translate(
+            parsed_symbol_table=parsed_symbol_table,
+            atok=atok,
+        )
+    if error is not None:
+        run.write_error_report(
+            message=f"Failed to translate the parsed symbol table "
+            f"to intermediate symbol table "
+            f"based on {model_path}",
+            errors=[lineno_columner.error_message(error)],
+            stderr=stderr,
+        )
+
+        return None
+
+    assert ir_symbol_table is not None
+
+    return ir_symbol_table, lineno_columner
+
+
+#: Memoized results of the parsing and the intermediate translation, mapping
+#: the SHA-256 of the meta-model source to the translated symbol table and
+#: the corresponding line/column resolver
+TranslationMemo = MutableMapping[str, Tuple[intermediate.SymbolTable, LinenoColumner]]
+
 
 # noinspection SpellCheckingInspection
-def execute(params: Parameters, stdout: TextIO, stderr: TextIO) -> int:
-    """Run the program."""
+def execute(
+    params: Parameters,
+    stdout: TextIO,
+    stderr: TextIO,
+    translation_memo: Optional[TranslationMemo] = None,
+) -> int:
+    """
+    Run the program.
+
+    If ``translation_memo`` is given, the parsed and translated meta-model is
+    memoized in it across the calls so that repeated runs within the same
+    process (*e.g.*, in the watch mode) skip the parsing and the translation
+    when the meta-model did not change.
+    """
     # region Basic checks
     # BEFORE-RELEASE (mristin, 2021-12-13): test this failure case
     if not params.model_path.exists():
@@ -72,25 +444,43 @@ def execute(params: Parameters, stdout: TextIO, stderr: TextIO) -> int:
         )
         return 1
 
-    # BEFORE-RELEASE (mristin, 2021-12-13): test the happy path
-    if not params.output_dir.exists():
-        params.output_dir.mkdir(parents=True, exist_ok=True)
+    if params.output_dir is not None:
+        # BEFORE-RELEASE (mristin, 2021-12-13): test the happy path
+        if not params.output_dir.exists():
+            params.output_dir.mkdir(parents=True, exist_ok=True)
+        else:
+            # BEFORE-RELEASE (mristin, 2021-12-13): test this failure case
+            if not params.output_dir.is_dir():
+                stderr.write(
+                    f"The --output_dir does not point to a directory: "
+                    f"{params.output_dir}\n"
+                )
+                return 1
     else:
-        # BEFORE-RELEASE (mristin, 2021-12-13): test this failure case
-        if not params.output_dir.is_dir():
+        assert params.output_bundle is not None
+        if (
+            str(params.output_bundle) != "-"
+            and not params.output_bundle.parent.is_dir()
+        ):
             stderr.write(
-                f"The --output_dir does not point to a directory: "
-                f"{params.output_dir}\n"
+                f"The parent directory of the --output_bundle does not exist: "
+                f"{params.output_bundle.parent}\n"
             )
             return 1
 
     # endregion
 
+    profiler = profiling.Profiler() if params.profile else None
+
     # region Parse
 
-    spec_impls, spec_impls_errors = specific_implementations.read_from_directory(
-        snippets_dir=params.snippets_dir
-    )
+    with profiling.measure_if(profiler, "specific_implementations.read_from_directory"):
+        (
+            spec_impls,
+            spec_impls_errors,
+        ) = specific_implementations.read_from_directory(
+            snippets_dir=params.snippets_dir
+        )
 
     if spec_impls_errors:
         run.write_error_report(
@@ -105,97 +495,178 @@ def execute(params: Parameters, stdout: TextIO, stderr: TextIO) -> int:
 
     text = params.model_path.read_text(encoding="utf-8")
 
-    # BEFORE-RELEASE (mristin, 2021-12-13):
-    #  test all the following individual failure cases
-    atok, parse_exception = parse.source_to_atok(source=text)
-    if parse_exception:
-        if isinstance(parse_exception, SyntaxError):
-            stderr.write(
-                f"Failed to parse the meta-model {params.model_path}: "
-                f"invalid syntax at line {parse_exception.lineno}\n"
-            )
-        else:
-            stderr.write(
-                f"Failed to parse the meta-model {params.model_path}: "
-                f"{parse_exception}\n"
-            )
+    memo_key = None  # type: Optional[str]
+    if translation_memo is not None:
+        memo_key = hashlib.sha256(text.encode("utf-8")).hexdigest()
 
-        return 1
+    cache_key = None  # type: Optional[str]
+    cached = None  # type: Optional[Tuple[intermediate.SymbolTable, LinenoColumner]]
 
-    import_errors = parse.check_expected_imports(atok=atok)
-    if import_errors:
-        run.write_error_report(
-            message="One or more unexpected imports in the meta-model",
-            errors=import_errors,
-            stderr=stderr,
+    if memo_key is not None and translation_memo is not None:
+        cached = translation_memo.get(memo_key, None)
+
+    if cached is None and params.cache_dir is not None:
+        cache_key = caching.compute_key(model_text=text, spec_impls=spec_impls)
+        cached = caching.load(cache_dir=params.cache_dir, key=cache_key)
+
+    if cached is not None:
+        ir_symbol_table, lineno_columner = cached
+    else:
+        translated = _parse_and_translate(
+            model_path=params.model_path, text=text, stderr=stderr, profiler=profiler
         )
+        if translated is None:
+            return 1
 
-        return 1
+        ir_symbol_table, lineno_columner = translated
 
-    lineno_columner = LinenoColumner(atok=atok)
+        if params.cache_dir is not None:
+            assert cache_key is not None
+            caching.store(
+                cache_dir=params.cache_dir,
+                key=cache_key,
+                symbol_table=ir_symbol_table,
+                lineno_columner=lineno_columner,
+                stderr=stderr,
+            )
 
-    parsed_symbol_table, error = parse.atok_to_symbol_table(atok=atok)
-    if error is not None:
-        run.write_error_report(
-            message=f"Failed to construct the symbol table from {params.model_path}",
-            errors=[lineno_columner.error_message(error)],
-            stderr=stderr,
-        )
+    if translation_memo is not None:
+        assert memo_key is not None
+        translation_memo[memo_key] = (ir_symbol_table, lineno_columner)
 
-        return 1
+    # endregion
 
-    assert parsed_symbol_table is not None
+    # region Dispatch
 
-    ir_symbol_table, error = intermediate.translate(
-        parsed_symbol_table=parsed_symbol_table,
-        atok=atok,
-    )
-    if error is not None:
-        run.write_error_report(
-            message=f"Failed to translate the parsed symbol table "
-            f"to intermediate symbol table "
-            f"based on {params.model_path}",
-            errors=[lineno_columner.error_message(error)],
-            stderr=stderr,
+    # NOTE (mristin, 2022-07-12):
+    # When a bundle was requested, we generate into a local temporary
+    # directory and pack its content as one sequential archive at the end,
+    # so that a networked filesystem sees a single artifact instead of
+    # many small file writes.
+    tmp_output_dir = None  # type: Optional[tempfile.TemporaryDirectory]
+    if params.output_bundle is not None:
+        # pylint: disable=consider-using-with
+        tmp_output_dir = tempfile.TemporaryDirectory()
+        output_dir = pathlib.Path(tmp_output_dir.name)
+    else:
+        assert params.output_dir is not None
+        output_dir = params.output_dir
+
+    try:
+        run_context = run.Context(
+            model_path=params.model_path,
+            symbol_table=ir_symbol_table,
+            spec_impls=spec_impls,
+            lineno_columner=lineno_columner,
+            output_dir=output_dir,
+            profiler=profiler,
         )
 
-        return 1
+        if len(params.targets) == 1 or profiler is not None:
+            # NOTE (mristin, 2022-06-11):
+            # When profiling, we run the targets sequentially even if there are
+            # multiple of them. The records of the worker processes would be lost
+            # on the way back, and the measurements of concurrently running
+            # generators would step on each other anyhow.
+            exit_code = 0
+            for target in params.targets:
+                with profiling.measure_if(profiler, f"{target.value}.execute"):
+                    target_exit_code = _execute_target(
+                        context=run_context, target=target, stdout=stdout, stderr=stderr
+                    )
+
+                if target_exit_code != 0 and exit_code == 0:
+                    exit_code = target_exit_code
+        else:
+            exit_code = _execute_targets_in_parallel(
+                context=run_context, targets=params.targets, stdout=stdout, stderr=stderr
+            )
 
-    assert ir_symbol_table is not None
+        if exit_code == 0 and params.output_bundle is not None:
+            exit_code = _pack_output_dir_into_bundle(
+                output_dir=output_dir,
+                output_bundle=params.output_bundle,
+                stdout=stdout,
+                stderr=stderr,
+            )
+    finally:
+        if tmp_output_dir is not None:
+            tmp_output_dir.cleanup()
+
+    if profiler is not None:
+        profiler.write_json(stream=stdout)
+
+    return exit_code
 
     # endregion
 
-    # region Dispatch
 
-    run_context = run.Context(
-        model_path=params.model_path,
-        symbol_table=ir_symbol_table,
-        spec_impls=spec_impls,
-        lineno_columner=lineno_columner,
-        output_dir=params.output_dir,
-    )
+#: Interval, in seconds, at which the watch mode polls the inputs for changes
+WATCH_POLL_INTERVAL = 0.2
 
-    if params.target is Target.CSHARP:
-        return csharp_main.execute(context=run_context, stdout=stdout, stderr=stderr)
 
-    elif params.target is Target.JSONSCHEMA:
-        return jsonschema_main.execute(
-            context=run_context, stdout=stdout, stderr=stderr
-        )
+def _snapshot_of_inputs(params: Parameters) -> Mapping[str, Tuple[int, int]]:
+    """
+    Take a snapshot of the input files as a map path -> (mtime, size).
 
-    elif params.target is Target.RDF_SHACL:
-        return rdf_shacl_main.execute(context=run_context, stdout=stdout, stderr=stderr)
+    Files which disappear between the listing and the stat are simply left out;
+    the next poll will pick up a consistent state.
+    """
+    snapshot = dict()  # type: MutableMapping[str, Tuple[int, int]]
 
-    elif params.target is Target.XSD:
-        return xsd_main.execute(context=run_context, stdout=stdout, stderr=stderr)
+    paths = [params.model_path] + [
+        pth for pth in params.snippets_dir.glob("**/*") if not pth.is_dir()
+    ]
 
-    else:
-        assert_never(params.target)
+    for pth in paths:
+        try:
+            stat = pth.stat()
+        except OSError:
+            continue
 
-    # endregion
+        snapshot[str(pth)] = (stat.st_mtime_ns, stat.st_size)
 
-    stdout.write(f"Code generated to: {params.output_dir}\n")
-    return 0
+    return snapshot
+
+
+def watch(params: Parameters, stdout: TextIO, stderr: TextIO) -> int:
+    """
+    Run the generation in a loop, re-generating whenever the inputs change.
+
+    The parsed and translated meta-model is memoized in-process, so an edit
+    which touches only the snippets re-runs just the generation phase instead
+    of paying for a cold start of the whole parsing and translation.
+    """
+    translation_memo = dict()  # type: TranslationMemo
+
+    last_snapshot = None  # type: Optional[Mapping[str, Tuple[int, int]]]
+
+    try:
+        while True:
+            snapshot = _snapshot_of_inputs(params=params)
+            if snapshot == last_snapshot:
+                time.sleep(WATCH_POLL_INTERVAL)
+                continue
+
+            last_snapshot = snapshot
+
+            start = time.perf_counter()
+            exit_code = execute(
+                params=params,
+                stdout=stdout,
+                stderr=stderr,
+                translation_memo=translation_memo,
+            )
+            duration = time.perf_counter() - start
+
+            if exit_code == 0:
+                stdout.write(f"Generated in {duration:.3f} seconds; watching...\n")
+            else:
+                stderr.write(
+                    f"Generation failed with the exit code {exit_code}; watching...\n"
+                )
+    except KeyboardInterrupt:
+        return 0
 
 
 def main(prog: str) -> int:
@@ -212,15 +683,59 @@ def main(prog: str) -> int:
         help="path to the directory containing implementation-specific code snippets",
         required=True,
     )
-    parser.add_argument(
-        "--output_dir", help="path to the generated code", required=True
+    output_group = parser.add_mutually_exclusive_group(required=True)
+    output_group.add_argument(
+        "--output_dir", help="path to the generated code"
     )
-    parser.add_argument(
+    output_group.add_argument(
+        "--output_bundle",
+        help=(
+            "path to a tar archive to which all the generated artifacts are "
+            "packed instead of writing individual files; "
+            "use '-' to stream the archive to the standard output"
+        ),
+    )
+    target_group = parser.add_mutually_exclusive_group(required=True)
+    target_group.add_argument(
         "--target",
         help="target language or schema",
-        required=True,
         choices=[literal.value for literal in Target],
     )
+    target_group.add_argument(
+        "--targets",
+        help=(
+            "multiple target languages or schemas; "
+            "the meta-model is parsed and translated only once and "
+            "the generators run in parallel over worker processes"
+        ),
+        nargs="+",
+        choices=[literal.value for literal in Target],
+    )
+    parser.add_argument(
+        "--cache_dir",
+        help=(
+            "path to the cache directory; "
+            "if specified, the parsed and translated meta-model is re-used "
+            "between the runs as long as neither the meta-model "
+            "nor the snippets changed"
+        ),
+    )
+    parser.add_argument(
+        "--watch",
+        help=(
+            "watch the meta-model and the snippets for changes and re-generate "
+            "on every change; the parsed meta-model is kept warm in-process"
+        ),
+        action="store_true",
+    )
+    parser.add_argument(
+        "--profile",
+        help=(
+            "report the wall time, the CPU time and the peak memory over "
+            "the generation phases as JSON on the standard output"
+        ),
+        action="store_true",
+    )
     parser.add_argument(
         "--version", help="show the current version and exit", action="store_true"
     )
@@ -236,13 +751,36 @@ def main(prog: str) -> int:
 
     target_to_str = {literal.value: literal for literal in Target}
 
+    target = None  # type: Optional[Target]
+    targets = None  # type: Optional[List[Target]]
+    if args.target is not None:
+        target = target_to_str[args.target]
+    else:
+        assert args.targets is not None
+        targets = [target_to_str[value] for value in args.targets]
+
     params = Parameters(
         model_path=pathlib.Path(args.model_path),
-        target=target_to_str[args.target],
+        target=target,
+        targets=targets,
         snippets_dir=pathlib.Path(args.snippets_dir),
-        output_dir=pathlib.Path(args.output_dir),
+        output_dir=(
+            pathlib.Path(args.output_dir) if args.output_dir is not None else None
+        ),
+        output_bundle=(
+            pathlib.Path(args.output_bundle)
+            if args.output_bundle is not None
+            else None
+        ),
+        cache_dir=(
+            pathlib.Path(args.cache_dir) if args.cache_dir is not None else None
+        ),
+        profile=args.profile,
     )
 
+    if args.watch:
+        return watch(params=params, stdout=sys.stdout, stderr=sys.stderr)
+
     return execute(params=params, stdout=sys.stdout, stderr=sys.stderr)
 
 
@@ -9,6 +9,7 @@ import textwrap
 from typing import (
     List,
     Any,
+    Deque,
     Optional,
     Type,
     Tuple,
@@ -102,6 +103,13 @@ class _ExpectedImportsVisitor(ast.NodeVisitor):
     def __init__(self) -> None:
         self.errors = []  # type: List[Error]
 
+    def generic_visit(self, node: ast.AST) -> None:
+        # NOTE (mristin, 2022-07-12):
+        # We deliberately do not recurse into the children. The traversal over
+        # the statements is performed in :py:func:`check_expected_imports`, so
+        # the expression subtrees need never be visited.
+        pass
+
     def visit_Import(self, node: ast.Import) -> Any:
         self.errors.append(
             Error(
@@ -171,7 +179,25 @@ def check_expected_imports(atok: asttokens.ASTTokens) -> List[str]:
     Return errors, if any.
     """
     visitor = _ExpectedImportsVisitor()
-    visitor.visit(atok.tree)
+
+    # NOTE (mristin, 2022-07-12):
+    # Import statements can only live among the statements, so we traverse
+    # the statement level with an explicit queue instead of descending into
+    # every expression node with :py:meth:`ast.NodeVisitor.generic_visit`.
+    # The meta-models are large, and this check used to re-visit the whole
+    # module tree right before the translation visited it again.
+    queue = collections.deque(atok.tree.body)  # type: Deque[ast.AST]
+    while len(queue) > 0:
+        node = queue.popleft()
+        visitor.visit(node)
+
+        for _, field_value in ast.iter_fields(node):
+            if isinstance(field_value, list):
+                queue.extend(
+                    child
+                    for child in field_value
+                    if isinstance(child, (ast.stmt, ast.excepthandler))
+                )
 
     if len(visitor.errors) == 0:
         return []
@@ -20,6 +20,18 @@ PRIMITIVE_TYPES = {"bool", "int", "float", "str", "bytearray"}
 GENERIC_TYPES = {Identifier("List"), Identifier("Optional")}
 
 
+# NOTE (mristin, 2022-07-12):
+# We define ``__slots__`` on all the classes of the symbol table so that
+# the instances are laid out compactly and the attribute access is fast.
+# Symbol tables of realistic meta-models contain tens of thousands of these
+# nodes, so the compact layout is worthwhile.
+#
+# Mind that the classes inheriting from :py:class:`icontract.DBC` still carry
+# an instance ``__dict__`` since the base class does not define ``__slots__``
+# itself. The slots nevertheless keep that dictionary empty and guard against
+# accidental attribute assignments.
+
+
 class AtomicTypeAnnotation:
     """
     Represent an atomic type annotation, such as ``Asset`` or ``int``.
@@ -27,6 +39,8 @@ class AtomicTypeAnnotation:
     Atomic, in this context, means a non-generic type such as ``List``.
     """
 
+    __slots__ = ("identifier", "node")
+
     def __init__(self, identifier: Identifier, node: ast.AST) -> None:
         """Initialize with the given values."""
         self.identifier = identifier
@@ -46,6 +60,8 @@ class AtomicTypeAnnotation:
 class SelfTypeAnnotation:
     """Provide a placeholder for the special argument ``self`` in a method"""
 
+    __slots__ = ()
+
     def __str__(self) -> str:
         return "SELF"
 
@@ -53,6 +69,8 @@ class SelfTypeAnnotation:
 class SubscriptedTypeAnnotation:
     """Represent a subscripted type annotation such as ``Optional[...]``."""
 
+    __slots__ = ("identifier", "subscripts", "node")
+
     def __init__(
         self,
         identifier: Identifier,
@@ -90,6 +108,8 @@ TypeAnnotation = Union[
 class ReferenceInTheBook:
     """Represent the information indicated in the ``reference_in_the_book`` marker."""
 
+    __slots__ = ("section", "index", "fragment")
+
     #: Section number
     section: Final[Tuple[int, ...]]
 
@@ -113,6 +133,8 @@ class ReferenceInTheBook:
 class Description:
     """Represent a docstring describing something in the meta-model."""
 
+    __slots__ = ("document", "node")
+
     @require(lambda node: isinstance(node.value, str))
     def __init__(self, document: docutils.nodes.document, node: ast.Constant) -> None:
         """Initialize with the given values."""
@@ -126,6 +148,8 @@ class Description:
 class SetLiteral:
     """Represent a literal as an item of a constant set."""
 
+    __slots__ = ("node",)
+
     #: Original node of the meta-model's Python AST
     node: Final[Union[ast.Attribute, ast.Constant]]
 
@@ -137,6 +161,8 @@ class SetLiteral:
 class Constant(DBC):
     """Represent a constant in the meta-model."""
 
+    __slots__ = ("name", "reference_in_the_book", "description", "node")
+
     #: Name of the constant
     name: Final[Identifier]
 
@@ -171,6 +197,8 @@ class Constant(DBC):
 class ConstantPrimitive(Constant):
     """Represent a constant value in the meta-model of primitive type."""
 
+    __slots__ = ("value",)
+
     value: Final[Union[bool, int, float, str, bytearray]]
 
     def __init__(
@@ -202,6 +230,8 @@ class ConstantPrimitive(Constant):
 class ConstantSet(Constant):
     """Represent a constant set in the meta-model."""
 
+    __slots__ = ("items_type_annotation", "set_literals", "subsets")
+
     # NOTE (mristin, 2022-07-01):
     # At this moment, we only support enumeration subsets and sets of strings. That is
     # why we enforce only the atomic type annotations for the
@@ -258,6 +288,8 @@ class Property:
     be set with the appropriate ``Optional`` type.
     """
 
+    __slots__ = ("name", "type_annotation", "description", "node")
+
     def __init__(
         self,
         name: Identifier,
@@ -275,6 +307,8 @@ class Property:
 class Default:
     """Represent a default value for an argument."""
 
+    __slots__ = ("node",)
+
     def __init__(self, node: ast.AST) -> None:
         """Initialize with the given values."""
         self.node = node
@@ -283,6 +317,8 @@ class Default:
 class Argument:
     """Represent an argument of a method."""
 
+    __slots__ = ("name", "type_annotation", "default", "node")
+
     def __init__(
         self,
         name: Identifier,
@@ -300,6 +336,8 @@ class Argument:
 class Invariant:
     """Represent an invariant of a class."""
 
+    __slots__ = ("description", "body", "node")
+
     def __init__(
         self, description: Optional[str], body: tree.Expression, node: ast.AST
     ) -> None:
@@ -311,6 +349,8 @@ class Invariant:
 class Contract:
     """Represent a contract of a method."""
 
+    __slots__ = ("args", "description", "body", "node")
+
     def __init__(
         self,
         args: Sequence[Identifier],
@@ -327,6 +367,8 @@ class Contract:
 class Snapshot:
     """Represent a snapshot of an OLD value capture before the method execution."""
 
+    __slots__ = ("args", "name", "body", "node")
+
     def __init__(
         self,
         args: Sequence[Identifier],
@@ -344,6 +386,8 @@ class Snapshot:
 class Contracts:
     """Represent the set of contracts for a method."""
 
+    __slots__ = ("preconditions", "snapshots", "postconditions")
+
     def __init__(
         self,
         preconditions: Sequence[Contract],
@@ -384,6 +428,17 @@ class Method(DBC):
     both of them "methods" in our model.
     """
 
+    __slots__ = (
+        "name",
+        "verification",
+        "arguments",
+        "returns",
+        "description",
+        "contracts",
+        "node",
+        "arguments_by_name",
+    )
+
     #: Name of the method
     name: Final[Identifier]
 
@@ -485,6 +540,8 @@ class ImplementationSpecificMethod(Method):
     target implementation.
     """
 
+    __slots__ = ()
+
     def __repr__(self) -> str:
         """Represent the instance as a string for easier debugging."""
         return (
@@ -499,6 +556,8 @@ class UnderstoodMethod(Method):
     We use :py:mod:`aas_core_codegen.parse._rules` to understand it.
     """
 
+    __slots__ = ("body",)
+
     #: Body as an AST that we could understand with
     #: :py:mod:`aas_core_codegen.parse._rules`
     body: Final[Sequence[tree.Node]]
@@ -543,6 +602,8 @@ class ConstructorToBeUnderstood(Method):
     understand it.
     """
 
+    __slots__ = ("body",)
+
     #: Body of the constructor as Python AST. We will understand it in the intermediate
     #: phase using :py:mod:`aas_core_codegen.intermediate.construction`.
     body: Final[Sequence[ast.AST]]
@@ -587,6 +648,8 @@ class ConstructorToBeUnderstood(Method):
 class Serialization:
     """Define general settings for the de/serialization of a specific class."""
 
+    __slots__ = ("with_model_type",)
+
     def __init__(self, with_model_type: Optional[bool]) -> None:
         """
         Initialize with the given values.
@@ -599,6 +662,21 @@ class Serialization:
 class Class(DBC):
     """Represent a class of the meta-model."""
 
+    __slots__ = (
+        "name",
+        "is_implementation_specific",
+        "inheritances",
+        "properties",
+        "methods",
+        "invariants",
+        "serialization",
+        "reference_in_the_book",
+        "description",
+        "node",
+        "properties_by_name",
+        "methods_by_name",
+    )
+
     #: Name of the class
     name: Final[Identifier]
 
@@ -708,6 +786,8 @@ class AbstractClass(Class):
     For example, ``Referable``.
     """
 
+    __slots__ = ()
+
     def __repr__(self) -> str:
         """Represent the class with a name for easier debugging."""
         return (
@@ -723,6 +803,8 @@ class ConcreteClass(Class):
     For example, ``Asset``.
     """
 
+    __slots__ = ()
+
     def __repr__(self) -> str:
         """Represent the class with a name for easier debugging."""
         return (
@@ -733,6 +815,8 @@ class ConcreteClass(Class):
 class EnumerationLiteral:
     """Represent a single enumeration literal."""
 
+    __slots__ = ("name", "value", "description", "node")
+
     def __init__(
         self,
         name: Identifier,
@@ -759,6 +843,15 @@ class EnumerationLiteral:
 class Enumeration:
     """Represent an enumeration."""
 
+    __slots__ = (
+        "name",
+        "literals",
+        "reference_in_the_book",
+        "description",
+        "node",
+        "literals_by_name",
+    )
+
     #: Name of the enumeration
     name: Final[Identifier]
 
@@ -802,6 +895,8 @@ OurType = Union[AbstractClass, ConcreteClass, Enumeration]
 class MetaModel:
     """Collect information about the underlying meta-model."""
 
+    __slots__ = ("book_url", "book_version", "description")
+
     #: Description of the meta-model extracted from the docstring
     description: Final[Optional[Description]]
 
@@ -826,6 +921,15 @@ class UnverifiedSymbolTable(DBC):
     This symbol table is unverified and may contain inconsistencies.
     """
 
+    __slots__ = (
+        "our_types",
+        "constants",
+        "verification_functions",
+        "meta_model",
+        "_name_to_our_type",
+        "_name_to_constant",
+    )
+
     #: List of parsed our types
     our_types: Final[Sequence[OurType]]
 
@@ -953,6 +1057,8 @@ class SymbolTable(UnverifiedSymbolTable):
     been verified yet.
     """
 
+    __slots__ = ()
+
     # fmt: off
     @require(
         lambda symbol_table:
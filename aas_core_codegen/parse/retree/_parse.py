@@ -1,9 +1,10 @@
 """Parse a regular expression defined over a possibly-formatted string."""
 
+import copy
 import io
 import math
 import re
-from typing import Tuple, Optional, List, Sequence, Union
+from typing import Mapping, MutableMapping, Tuple, Optional, List, Sequence, Union
 
 from icontract import invariant, require, ensure, snapshot
 
@@ -392,6 +393,47 @@ class Error:
 _UNEXPECTED_CHARACTERS_IN_REGEX_RE = re.compile("[\\n\\f\\v\\r]")
 _WHITESPACE_RE = re.compile("\\s")
 
+_HEX_2_RE = re.compile(r"[a-fA-F0-9]{2}")
+_HEX_4_RE = re.compile(r"[a-fA-F0-9]{4}")
+_HEX_8_RE = re.compile(r"[a-fA-F0-9]{8}")
+
+#: Map the second character of a two-character escape sequence in a character set
+#: to the escaped character
+_RANGE_CHAR_ESCAPES = {
+    "t": "\t",
+    "n": "\n",
+    "r": "\r",
+    "f": "\f",
+    "v": "\v",
+    "\\": "\\",
+    "[": "[",
+    "]": "]",
+    "^": "^",
+    "-": "-",
+}  # type: Mapping[str, str]
+
+#: Map the second character of a two-character escape sequence in a concatenation
+#: to the escaped character
+_CHAR_LITERAL_ESCAPES = {
+    "t": "\t",
+    "n": "\n",
+    "r": "\r",
+    "f": "\f",
+    "v": "\v",
+    ".": ".",
+    "#": "#",
+    "^": "^",
+    "$": "$",
+    "(": "(",
+    ")": ")",
+    "[": "[",
+    "]": "]",
+    "\\": "\\",
+    "*": "*",
+    "+": "+",
+    "?": "?",
+}  # type: Mapping[str, str]
+
 
 @require(lambda cursor: len(cursor.values) > 0)
 @ensure(lambda result: len(result[0]) > 0 and len(result[1]) > 0)
@@ -492,7 +534,7 @@ def _parse_range_char(cursor: Cursor) -> Tuple[Optional[Char], Optional[Error]]:
             return None, Error("Expected two hexadecimal digits after \\x", cursor)
 
         # noinspection RegExpSimplifiable
-        if not re.fullmatch(r"[a-fA-F0-9]{2}", substring):
+        if not _HEX_2_RE.fullmatch(substring):
             return None, Error(
                 f"Expected two hexadecimal digits after \\x, " f"but got {substring!r}",
                 cursor,
@@ -505,7 +547,7 @@ def _parse_range_char(cursor: Cursor) -> Tuple[Optional[Char], Optional[Error]]:
         if substring is None:
             return None, Error("Expected four hexadecimal digits after \\u", cursor)
 
-        if not re.fullmatch(r"[a-fA-F0-9]{4}", substring):
+        if not _HEX_4_RE.fullmatch(substring):
             return None, Error(
                 f"Expected four hexadecimal digits after \\u, "
                 f"but got {substring!r}",
@@ -519,7 +561,7 @@ def _parse_range_char(cursor: Cursor) -> Tuple[Optional[Char], Optional[Error]]:
         if substring is None:
             return None, Error("Expected eight hexadecimal digits after \\U", cursor)
 
-        if not re.fullmatch(r"[a-fA-F0-9]{8}", substring):
+        if not _HEX_8_RE.fullmatch(substring):
             return None, Error(
                 f"Expected eight hexadecimal digits after \\U, "
                 f"but got {substring!r}",
@@ -537,52 +579,39 @@ def _parse_range_char(cursor: Cursor) -> Tuple[Optional[Char], Optional[Error]]:
             )
 
         result = Char(character=chr(code), explicitly_encoded=True)
-    elif cursor.try_literal("\\t"):
-        result = Char(character="\t")
-
-    elif cursor.try_literal("\\n"):
-        result = Char(character="\n")
-
-    elif cursor.try_literal("\\r"):
-        result = Char(character="\r")
-
-    elif cursor.try_literal("\\f"):
-        result = Char(character="\f")
-
-    elif cursor.try_literal("\\v"):
-        result = Char(character="\v")
-
-    elif cursor.try_literal("\\\\"):
-        result = Char(character="\\")
-
-    elif cursor.try_literal("\\["):
-        result = Char(character="[")
-
-    elif cursor.try_literal("\\]"):
-        result = Char(character="]")
-
-    elif cursor.try_literal("\\^"):
-        result = Char(character="^")
+    elif cursor.peek_literal("\\"):
+        # NOTE (mristin, 2022-06-09):
+        # The two-character escape sequences are dispatched over a table instead
+        # of stepping through a cascade of literal probes.
+        escaped = cursor.peek_substring(length=2)
+
+        character = (
+            _RANGE_CHAR_ESCAPES.get(escaped[1], None) if escaped is not None else None
+        )
 
-    elif cursor.try_literal("\\-"):
-        result = Char(character="-")
+        if character is not None:
+            cursor.try_substring(length=2)
+            result = Char(character=character)
 
-    elif cursor.try_literal("\\s") or cursor.try_literal("\\S"):
-        return None, Error(
-            "We do not handle whitespace escaping at the moment (2022-06-09), "
-            "as the notion of a whitespace depends on the regex engine",
-            cursor,
-        )
+        elif escaped is not None and escaped[1] in ("s", "S"):
+            cursor.try_substring(length=2)
+            return None, Error(
+                "We do not handle whitespace escaping at the moment (2022-06-09), "
+                "as the notion of a whitespace depends on the regex engine",
+                cursor,
+            )
 
-    elif cursor.try_literal("\\d") or cursor.try_literal("\\D"):
-        return None, Error(
-            "We do not handle digit escaping at the moment (2022-06-09), "
-            "as the notion of a digit depends on the regex engine",
-            cursor,
-        )
+        elif escaped is not None and escaped[1] in ("d", "D"):
+            cursor.try_substring(length=2)
+            return None, Error(
+                "We do not handle digit escaping at the moment (2022-06-09), "
+                "as the notion of a digit depends on the regex engine",
+                cursor,
+            )
 
-    elif cursor.try_literal("\\"):
-        return None, Error("Unexpected escaping", cursor)
+        else:
+            cursor.try_literal("\\")
+            return None, Error("Unexpected escaping", cursor)
 
     else:
         character = cursor.try_substring(length=1)
@@ -672,7 +701,7 @@ def _parse_char_literal(cursor: Cursor) -> Tuple[Optional[Char], Optional[Error]
         if substring is None:
             return None, Error("Expected two hexadecimal digits after \\x", cursor)
 
-        if not re.fullmatch(r"[a-fA-F0-9]{2}", substring):
+        if not _HEX_2_RE.fullmatch(substring):
             return None, Error(
                 f"Expected two hexadecimal digits after \\x, " f"but got {substring!r}",
                 cursor,
@@ -685,7 +714,7 @@ def _parse_char_literal(cursor: Cursor) -> Tuple[Optional[Char], Optional[Error]
         if substring is None:
             return None, Error("Expected four hexadecimal digits after \\u", cursor)
 
-        if not re.fullmatch(r"[a-fA-F0-9]{4}", substring):
+        if not _HEX_4_RE.fullmatch(substring):
             return None, Error(
                 f"Expected four hexadecimal digits after \\u, "
                 f"but got {substring!r}",
@@ -699,7 +728,7 @@ def _parse_char_literal(cursor: Cursor) -> Tuple[Optional[Char], Optional[Error]
         if substring is None:
             return None, Error("Expected eight hexadecimal digits after \\U", cursor)
 
-        if not re.fullmatch(r"[a-fA-F0-9]{8}", substring):
+        if not _HEX_8_RE.fullmatch(substring):
             return None, Error(
                 f"Expected eight hexadecimal digits after \\U, "
                 f"but got {substring!r}",
@@ -717,80 +746,49 @@ def _parse_char_literal(cursor: Cursor) -> Tuple[Optional[Char], Optional[Error]
             )
 
         result = Char(character=chr(code), explicitly_encoded=True)
-    elif cursor.try_literal("\\t"):
-        result = Char(character="\t")
-
-    elif cursor.try_literal("\\n"):
-        result = Char(character="\n")
-
-    elif cursor.try_literal("\\r"):
-        result = Char(character="\r")
-
-    elif cursor.try_literal("\\f"):
-        result = Char(character="\f")
-
-    elif cursor.try_literal("\\v"):
-        result = Char(character="\v")
-
-    elif cursor.try_literal("\\."):
-        result = Char(character=".")
-
-    elif cursor.try_literal("\\#"):
-        result = Char(character="#")
-
-    elif cursor.try_literal("\\^"):
-        result = Char(character="^")
-
-    elif cursor.try_literal("\\$"):
-        result = Char(character="$")
-
-    elif cursor.try_literal("\\("):
-        result = Char(character="(")
-
-    elif cursor.try_literal("\\)"):
-        result = Char(character=")")
-
-    elif cursor.try_literal("\\["):
-        result = Char(character="[")
-
-    elif cursor.try_literal("\\]"):
-        result = Char(character="]")
-
-    elif cursor.try_literal("\\\\"):
-        result = Char(character="\\")
-
-    elif cursor.try_literal("\\*"):
-        result = Char(character="*")
-
-    elif cursor.try_literal("\\+"):
-        result = Char(character="+")
+    elif cursor.peek_literal("\\"):
+        # NOTE (mristin, 2022-06-09):
+        # The two-character escape sequences are dispatched over a table instead
+        # of stepping through a cascade of literal probes.
+        escaped = cursor.peek_substring(length=2)
+
+        character = (
+            _CHAR_LITERAL_ESCAPES.get(escaped[1], None)
+            if escaped is not None
+            else None
+        )
 
-    elif cursor.try_literal("\\?"):
-        result = Char(character="?")
+        if character is not None:
+            cursor.try_substring(length=2)
+            result = Char(character=character)
 
-    elif cursor.try_literal("\\s") or cursor.try_literal("\\S"):
-        return None, Error(
-            "We do not handle whitespace escaping at the moment (2022-06-09), "
-            "as the notion of a whitespace depends on the regex engine",
-            cursor,
-        )
+        elif escaped is not None and escaped[1] in ("s", "S"):
+            cursor.try_substring(length=2)
+            return None, Error(
+                "We do not handle whitespace escaping at the moment (2022-06-09), "
+                "as the notion of a whitespace depends on the regex engine",
+                cursor,
+            )
 
-    elif cursor.try_literal("\\w") or cursor.try_literal("\\W"):
-        return None, Error(
-            "We do not handle word escaping at the moment (2022-06-09), "
-            "as the notion of a word depends on the regex engine",
-            cursor,
-        )
+        elif escaped is not None and escaped[1] in ("w", "W"):
+            cursor.try_substring(length=2)
+            return None, Error(
+                "We do not handle word escaping at the moment (2022-06-09), "
+                "as the notion of a word depends on the regex engine",
+                cursor,
+            )
 
-    elif cursor.try_literal("\\d") or cursor.try_literal("\\D"):
-        return None, Error(
-            "We do not handle digit escaping at the moment (2022-06-09), "
-            "as the notion of a digit depends on the regex engine",
-            cursor,
-        )
+        elif escaped is not None and escaped[1] in ("d", "D"):
+            cursor.try_substring(length=2)
+            return None, Error(
+                "We do not handle digit escaping at the moment (2022-06-09), "
+                "as the notion of a digit depends on the regex engine",
+                cursor,
+            )
 
-    elif cursor.try_literal("\\"):
-        return None, Error("Unexpected escaping", cursor)
+        else:
+            cursor.try_literal("\\")
+            return None, Error("Unexpected escaping", cursor)
 
     elif cursor.try_literal("^"):
         raise AssertionError(
@@ -1089,11 +1087,41 @@ def _parse_regex(cursor: Cursor) -> Tuple[Optional[Regex], Optional[Error]]:
     return Regex(union=union), None
 
 
+#: Memoized results of :py:func:`parse` for the patterns given as a single string.
+#:
+#: The same verification patterns are parsed independently by multiple consumers
+#: (the XSD generator, the pattern verification in the intermediate representation
+#: and the C# verification generator), so each distinct pattern is parsed exactly
+#: once per run.
+_PARSE_CACHE = (
+    dict()
+)  # type: MutableMapping[str, Tuple[Optional[Regex], Optional[Error]]]
+
+
 @ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
 def parse(
     values: Sequence[Union[str, FormattedValue]]
 ) -> Tuple[Optional[Regex], Optional[Error]]:
     """Try to parse the ``values`` into an AST representing the regular expression."""
+    # NOTE (mristin, 2022-06-09):
+    # Only the patterns given as a single string are cached. Patterns with
+    # formatted values depend on the enclosing joined string, so we leave them
+    # uncached.
+    if len(values) == 1 and isinstance(values[0], str):
+        pattern = values[0]
+
+        entry = _PARSE_CACHE.get(pattern, None)
+        if entry is None:
+            cursor = Cursor(values=[pattern])
+            entry = _parse_regex(cursor)
+            _PARSE_CACHE[pattern] = entry
+
+        # NOTE (mristin, 2022-06-09):
+        # The consumers mutate the parsed tree in place (*e.g.*, the UTF-16 fix
+        # in the C# verification generator), so we always hand out a deep copy
+        # and keep the pristine tree in the cache.
+        return copy.deepcopy(entry)
+
     cursor = Cursor(values=values)
     parsed, error = _parse_regex(cursor)
     return parsed, error
@@ -0,0 +1,112 @@
+"""Measure the wall time, the CPU time and the memory over generation phases."""
+
+import contextlib
+import json
+import sys
+import time
+from typing import ContextManager, Iterator, List, Optional, TextIO
+
+try:
+    # NOTE (mristin, 2022-06-11):
+    # The module ``resource`` is only available on Unix-like systems. We degrade
+    # gracefully on the other platforms and simply do not report the memory.
+    import resource
+except ImportError:
+    resource = None  # type: ignore
+
+
+def _max_rss_in_kilobytes() -> Optional[int]:
+    """
+    Return the peak resident set size of the process, in kilobytes.
+
+    On platforms without the ``resource`` module, return ``None``.
+    """
+    if resource is None:
+        return None
+
+    max_rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+
+    # NOTE (mristin, 2022-06-11):
+    # Linux reports ``ru_maxrss`` in kilobytes while Mac OS reports it in bytes.
+    if sys.platform == "darwin":
+        return max_rss // 1024
+
+    return max_rss
+
+
+class PhaseRecord:
+    """Represent the measurements over a single phase."""
+
+    def __init__(
+        self,
+        name: str,
+        wall_time: float,
+        cpu_time: float,
+        max_rss_kb: Optional[int],
+    ) -> None:
+        """Initialize with the given values."""
+        self.name = name
+        self.wall_time = wall_time
+        self.cpu_time = cpu_time
+        self.max_rss_kb = max_rss_kb
+
+
+class Profiler:
+    """
+    Collect the measurements over the phases of a generation run.
+
+    The phases are expected to be measured through :py:meth:`measure`. Nested
+    measurements are allowed; each phase is recorded on its own.
+    """
+
+    def __init__(self) -> None:
+        """Initialize the profiler with no records."""
+        self.records = []  # type: List[PhaseRecord]
+
+    @contextlib.contextmanager
+    def measure(self, phase: str) -> Iterator[None]:
+        """Measure the execution of the ``with`` block as the ``phase``."""
+        wall_start = time.perf_counter()
+        cpu_start = time.process_time()
+        try:
+            yield
+        finally:
+            self.records.append(
+                PhaseRecord(
+                    name=phase,
+                    wall_time=time.perf_counter() - wall_start,
+                    cpu_time=time.process_time() - cpu_start,
+                    max_rss_kb=_max_rss_in_kilobytes(),
+                )
+            )
+
+    def write_json(self, stream: TextIO) -> None:
+        """Write the collected records as JSON to the ``stream``."""
+        json.dump(
+            {
+                "phases": [
+                    {
+                        "name": record.name,
+                        "wall_time": record.wall_time,
+                        "cpu_time": record.cpu_time,
+                        "max_rss_kb": record.max_rss_kb,
+                    }
+                    for record in self.records
+                ]
+            },
+            stream,
+            indent=2,
+        )
+        stream.write("\n")
+
+
+def measure_if(profiler: Optional[Profiler], phase: str) -> ContextManager[None]:
+    """
+    Measure the ``with`` block if the ``profiler`` is given.
+
+    This helps the call sites avoid the branching when the profiling is off.
+    """
+    if profiler is None:
+        return contextlib.nullcontext()
+
+    return profiler.measure(phase)
@@ -29,6 +29,34 @@ def string_literal(text: str) -> Stripped:
 ClassToRdfsRange = MutableMapping[intermediate.ClassUnion, Stripped]
 
 
+class Registry:
+    """
+    Bundle the pre-computed view on the symbol table for the generators.
+
+    Both the RDF and the SHACL generator walk our types in the order of their
+    RDF/SHACL class names and resolve the same ``rdfs:range`` mapping, so we
+    compute these once and share them instead of re-deriving them per document.
+    """
+
+    def __init__(
+        self,
+        symbol_table: intermediate.SymbolTable,
+        class_to_rdfs_range: ClassToRdfsRange,
+        url_prefix: Stripped,
+    ) -> None:
+        """Initialize with the given values and pre-compute the sorted view."""
+        self.symbol_table = symbol_table
+        self.class_to_rdfs_range = class_to_rdfs_range
+        self.url_prefix = url_prefix
+
+        #: Our types sorted by their RDF/SHACL class names, so that the entities
+        #: appear sorted in the resulting documents
+        self.our_types_sorted = sorted(
+            symbol_table.our_types,
+            key=lambda our_type: rdf_shacl_naming.class_name(our_type.name),
+        )  # type: List[intermediate.OurType]
+
+
 @ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
 def map_class_to_rdfs_range(
     symbol_table: intermediate.SymbolTable,
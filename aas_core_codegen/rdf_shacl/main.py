@@ -1,5 +1,6 @@
 """Generate the RDF ontology and the SHACL schema corresponding to the meta-model."""
 
+import concurrent.futures
 import pathlib
 from typing import TextIO
 
@@ -53,17 +54,61 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
         )
         return 1
 
-    # endregion
+    # NOTE (mristin, 2022-07-12):
+    # The constraint inference is shared over the context so that the schema
+    # targets do not infer the same constraints thrice in a multi-target run.
+    constraints_by_class, inference_errors = context.infer_constraints_by_class()
 
-    # region RDF ontology
+    if inference_errors is not None:
+        run.write_error_report(
+            message=f"Failed to infer the constraints for the SHACL schema "
+            f"based on {context.model_path}",
+            errors=[
+                context.lineno_columner.error_message(error)
+                for error in inference_errors
+            ],
+            stderr=stderr,
+        )
+        return 1
 
-    rdf_code, errors = aas_core_codegen.rdf_shacl.rdf.generate(
+    assert constraints_by_class is not None
+
+    registry = rdf_shacl_common.Registry(
         symbol_table=context.symbol_table,
         class_to_rdfs_range=class_to_rdfs_range,
-        spec_impls=context.spec_impls,
         url_prefix=url_prefix,
     )
 
+    # endregion
+
+    # region Generate
+
+    # NOTE (mristin, 2022-07-12):
+    # The RDF ontology and the SHACL schema are generated independently from
+    # the shared registry, so we overlap the two generators over a thread
+    # pool. The errors, if any, are still reported deterministically in
+    # the order RDF first, SHACL second.
+    with concurrent.futures.ThreadPoolExecutor(max_workers=2) as executor:
+        rdf_future = executor.submit(
+            aas_core_codegen.rdf_shacl.rdf.generate,
+            registry=registry,
+            spec_impls=context.spec_impls,
+        )
+
+        shacl_future = executor.submit(
+            aas_core_codegen.rdf_shacl.shacl.generate,
+            registry=registry,
+            spec_impls=context.spec_impls,
+            constraints_by_class=constraints_by_class,
+        )
+
+        rdf_code, errors = rdf_future.result()
+        shacl_code, shacl_errors = shacl_future.result()
+
+    # endregion
+
+    # region RDF ontology
+
     if errors is not None:
         run.write_error_report(
             message=f"Failed to generate the RDF ontology "
@@ -77,7 +122,7 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
 
     pth = context.output_dir / "rdf-ontology.ttl"
     try:
-        pth.write_text(rdf_code, encoding="utf-8")
+        run.write_if_different(pth, rdf_code)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the RDF ontology to {pth}",
@@ -90,18 +135,14 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
 
     # region SHACL schema
 
-    shacl_code, errors = aas_core_codegen.rdf_shacl.shacl.generate(
-        symbol_table=context.symbol_table,
-        class_to_rdfs_range=class_to_rdfs_range,
-        spec_impls=context.spec_impls,
-        url_prefix=url_prefix,
-    )
-
-    if errors is not None:
+    if shacl_errors is not None:
         run.write_error_report(
             message=f"Failed to generate the SHACL schema "
             f"based on {context.model_path}",
-            errors=[context.lineno_columner.error_message(error) for error in errors],
+            errors=[
+                context.lineno_columner.error_message(error)
+                for error in shacl_errors
+            ],
             stderr=stderr,
         )
         return 1
@@ -110,7 +151,7 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
 
     pth = context.output_dir / "shacl-schema.ttl"
     try:
-        pth.write_text(shacl_code, encoding="utf-8")
+        run.write_if_different(pth, shacl_code)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the SHACL schema to {pth}",
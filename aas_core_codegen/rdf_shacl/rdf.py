@@ -321,12 +321,13 @@ def _define_for_class(
 
 @ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
 def generate(
-    symbol_table: intermediate.SymbolTable,
-    class_to_rdfs_range: rdf_shacl_common.ClassToRdfsRange,
+    registry: rdf_shacl_common.Registry,
     spec_impls: specific_implementations.SpecificImplementations,
-    url_prefix: Stripped,
 ) -> Tuple[Optional[Stripped], Optional[List[Error]]]:
-    """Generate the RDF ontology based on the ``symbol_table."""
+    """Generate the RDF ontology based on the ``registry``."""
+    class_to_rdfs_range = registry.class_to_rdfs_range
+    url_prefix = registry.url_prefix
+
     errors = []  # type: List[Error]
 
     preamble_key = specific_implementations.ImplementationKey("rdf/preamble.ttl")
@@ -346,10 +347,7 @@ def generate(
     assert preamble is not None
     blocks = [preamble]  # type: List[Stripped]
 
-    for our_type in sorted(
-        symbol_table.our_types,
-        key=lambda another_our_type: rdf_shacl_naming.class_name(another_our_type.name),
-    ):
+    for our_type in registry.our_types_sorted:
         if isinstance(our_type, intermediate.Enumeration):
             block, error = _define_for_enumeration(
                 enumeration=our_type, url_prefix=url_prefix
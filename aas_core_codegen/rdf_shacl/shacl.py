@@ -1,7 +1,7 @@
 """Generate the SHACL schema based on the meta-model."""
 import io
 import textwrap
-from typing import Tuple, Optional, List
+from typing import Tuple, Optional, List, MutableMapping
 
 from icontract import ensure, require
 
@@ -274,12 +274,16 @@ sh:sparql [
 
 @ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
 def generate(
-    symbol_table: intermediate.SymbolTable,
-    class_to_rdfs_range: rdf_shacl_common.ClassToRdfsRange,
+    registry: rdf_shacl_common.Registry,
     spec_impls: specific_implementations.SpecificImplementations,
-    url_prefix: Stripped,
+    constraints_by_class: MutableMapping[
+        intermediate.ClassUnion, infer_for_schema.ConstraintsByProperty
+    ],
 ) -> Tuple[Optional[Stripped], Optional[List[Error]]]:
-    """Generate the SHACL schema based on the ``symbol_table."""
+    """Generate the SHACL schema based on the ``registry``."""
+    class_to_rdfs_range = registry.class_to_rdfs_range
+    url_prefix = registry.url_prefix
+
     errors = []  # type: List[Error]
 
     preamble_key = specific_implementations.ImplementationKey("shacl/preamble.ttl")
@@ -300,22 +304,7 @@ def generate(
     assert preamble is not None
     blocks = [preamble]  # type: List[Stripped]
 
-    constraints_by_class, some_errors = infer_for_schema.infer_constraints_by_class(
-        symbol_table=symbol_table
-    )
-
-    if some_errors is not None:
-        errors.extend(some_errors)
-
-    if len(errors) > 0:
-        return None, errors
-
-    assert constraints_by_class is not None
-
-    for our_type in sorted(
-        symbol_table.our_types,
-        key=lambda another_our_type: rdf_shacl_naming.class_name(another_our_type.name),
-    ):
+    for our_type in registry.our_types_sorted:
         # noinspection PyUnusedLocal
         block = None  # type: Optional[Stripped]
 
@@ -1,12 +1,35 @@
 """Encapsulate the entry point to different generators."""
+import hashlib
+import os
 import pathlib
+import stat
+import tempfile
 import textwrap
-from typing import Sequence, TextIO
+from typing import (
+    Iterable,
+    List,
+    MutableMapping,
+    Optional,
+    Sequence,
+    TextIO,
+    Tuple,
+    Union,
+)
 
 from icontract import require
 
-from aas_core_codegen import specific_implementations, intermediate
-from aas_core_codegen.common import LinenoColumner
+from aas_core_codegen import (
+    infer_for_schema,
+    profiling,
+    specific_implementations,
+    intermediate,
+)
+from aas_core_codegen.common import Error, LinenoColumner
+
+#: Constraints inferred for the schemas, mapped by the classes of the symbol table
+ConstraintsByClass = MutableMapping[
+    intermediate.ClassUnion, infer_for_schema.ConstraintsByProperty
+]
 
 
 class Context:
@@ -21,6 +44,7 @@ class Context:
         spec_impls: specific_implementations.SpecificImplementations,
         lineno_columner: LinenoColumner,
         output_dir: pathlib.Path,
+        profiler: Optional[profiling.Profiler] = None,
     ) -> None:
         """Initialize with the given values."""
         self.model_path = model_path
@@ -28,6 +52,100 @@ class Context:
         self.spec_impls = spec_impls
         self.lineno_columner = lineno_columner
         self.output_dir = output_dir
+        self.profiler = profiler
+
+        self._constraints_by_class_result = (
+            None
+        )  # type: Optional[Tuple[Optional[ConstraintsByClass], Optional[List[Error]]]]
+
+    def infer_constraints_by_class(
+        self,
+    ) -> Tuple[Optional[ConstraintsByClass], Optional[List[Error]]]:
+        """
+        Infer the schema constraints from the invariants of the symbol table.
+
+        The result is computed on the first call and memoized for all the
+        subsequent calls, so that the schema targets do not derive the same
+        constraints over and over again.
+
+        When multiple targets run in parallel over forked worker processes,
+        the parent process must call this method once *before* the fork —
+        the workers then inherit the memoized result instead of each
+        re-inferring the constraints independently.
+        """
+        if self._constraints_by_class_result is None:
+            self._constraints_by_class_result = (
+                infer_for_schema.infer_constraints_by_class(
+                    symbol_table=self.symbol_table
+                )
+            )
+
+        return self._constraints_by_class_result
+
+
+def write_if_different(
+    pth: pathlib.Path, content: Union[str, Iterable[str]]
+) -> bool:
+    """
+    Write the ``content`` to ``pth`` unless the file already has that content.
+
+    The content is first spooled to a temporary file in the same directory
+    while its digest is computed. If the digest matches the digest of
+    the existing file, the temporary file is removed and ``pth`` is left
+    untouched, so that the downstream builds do not observe a bumped
+    modification time. On a real difference, the temporary file atomically
+    replaces ``pth``, so that a concurrent reader never observes a partially
+    written file.
+
+    :param pth: path to the output file
+    :param content: text, either as a whole or as a stream of chunks
+    :return: True if ``pth`` has been (re-)written
+    """
+    if isinstance(content, str):
+        content = (content,)
+
+    new_hasher = hashlib.sha256()
+
+    descriptor, tmp_name = tempfile.mkstemp(
+        dir=str(pth.parent), prefix=f"{pth.name}.", suffix=".tmp"
+    )
+    try:
+        with os.fdopen(descriptor, "wb") as fid:
+            for chunk in content:
+                encoded = chunk.encode("utf-8")
+                new_hasher.update(encoded)
+                fid.write(encoded)
+
+        if pth.exists():
+            old_hasher = hashlib.sha256()
+            with pth.open("rb") as target_fid:
+                for data in iter(lambda: target_fid.read(1024 * 1024), b""):
+                    old_hasher.update(data)
+
+            if old_hasher.digest() == new_hasher.digest():
+                os.remove(tmp_name)
+                return False
+
+        # NOTE (mristin, 2022-07-12):
+        # ``mkstemp`` creates the temporary file with the mode 0o600, which
+        # would otherwise leak through ``os.replace`` into the output file.
+        # We either carry over the mode of the file we are replacing, or
+        # apply the process umask as ``open`` would for a fresh file.
+        if pth.exists():
+            mode = stat.S_IMODE(os.stat(str(pth)).st_mode)
+        else:
+            umask = os.umask(0)
+            os.umask(umask)
+            mode = 0o666 & ~umask
+
+        os.chmod(tmp_name, mode)
+
+        os.replace(tmp_name, str(pth))
+        return True
+    except Exception:
+        if os.path.exists(tmp_name):
+            os.remove(tmp_name)
+        raise
 
 
 @require(
@@ -2,7 +2,15 @@
 
 import pathlib
 import re
-from typing import cast, Mapping, Tuple, Optional, List
+from typing import (
+    cast,
+    Iterator,
+    Mapping,
+    MutableMapping,
+    Tuple,
+    Optional,
+    List,
+)
 
 from icontract import require, ensure
 
@@ -23,16 +31,62 @@ class ImplementationKey(str):
 SpecificImplementations = Mapping[ImplementationKey, Stripped]
 
 
+class LazySpecificImplementations(Mapping[ImplementationKey, Stripped]):
+    """
+    Provide the snippets based on an index of the snippet files.
+
+    The directory is indexed once, up-front, while the content of a snippet
+    file is read only on the first access and cached thereafter. A generator
+    usually touches only a fraction of the snippets, so we spare ourselves
+    the reading of the whole snippets directory on startup.
+    """
+
+    def __init__(self, key_to_path: Mapping[ImplementationKey, pathlib.Path]) -> None:
+        """Initialize with the given index of the snippet files."""
+        self._key_to_path = key_to_path
+        self._cache = dict()  # type: MutableMapping[ImplementationKey, Stripped]
+
+    def __getitem__(self, key: ImplementationKey) -> Stripped:
+        value = self._cache.get(key, None)
+        if value is not None:
+            return value
+
+        path = self._key_to_path[key]
+
+        try:
+            value = Stripped(path.read_text(encoding="utf-8").strip())
+        except OSError as exception:
+            # NOTE (mristin, 2022-05-02):
+            # The file disappeared between the indexing and the access. We
+            # report it as a missing snippet so that the generators give
+            # a meaningful error instead of crashing.
+            raise KeyError(key) from exception
+
+        self._cache[key] = value
+        return value
+
+    def __iter__(self) -> Iterator[ImplementationKey]:
+        return iter(self._key_to_path)
+
+    def __len__(self) -> int:
+        return len(self._key_to_path)
+
+
 @ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
 def read_from_directory(
     snippets_dir: pathlib.Path,
 ) -> Tuple[Optional[SpecificImplementations], Optional[List[str]]]:
     """
-    Read all the implementation-specific code snippets from the ``snippets_dir``.
+    Index all the implementation-specific code snippets from the ``snippets_dir``.
+
+    The keys are validated and indexed eagerly while the snippet files
+    themselves are read lazily, on the first access.
 
     :return: either the map of the implementations, or the errors
     """
-    mapping = dict()  # pylint: disable=use-dict-literal
+    key_to_path = (
+        dict()
+    )  # type: MutableMapping[ImplementationKey, pathlib.Path]
 
     errors = []  # type: List[str]
     for pth in snippets_dir.glob("**/*"):
@@ -48,10 +102,9 @@ def read_from_directory(
             continue
 
         key = ImplementationKey(maybe_key)
-        value = Stripped(pth.read_text(encoding="utf-8").strip())
-        mapping[key] = value
+        key_to_path[key] = pth
 
     if errors:
         return None, errors
 
-    return mapping, None
+    return LazySpecificImplementations(key_to_path=key_to_path), None
@@ -6,7 +6,7 @@ import inspect
 import io
 import re
 import textwrap
-from typing import Sequence, Union, Any, Mapping, List, Tuple, Set
+from typing import Sequence, Union, Any, Generator, Mapping, List, Optional, Tuple, Set
 
 from icontract import require
 
@@ -71,8 +71,16 @@ class Entity:
         return dump(self)
 
 
-def dump(stringifiable: Stringifiable) -> str:
-    """Produce a string representation of ``stringifiable`` for debugging or testing."""
+def _transcribe(
+    stringifiable: Stringifiable,
+) -> Generator[Stringifiable, Optional[str], str]:
+    """
+    Render the ``stringifiable`` while delegating the rendering of the children.
+
+    The children are yielded to the caller and their renderings are expected
+    to be sent back into the generator. The final rendering is given in
+    the value of the :py:exc:`StopIteration`.
+    """
     if isinstance(stringifiable, (bool, int, float)):
         return repr(stringifiable)
 
@@ -98,7 +106,8 @@ def dump(stringifiable: Stringifiable) -> str:
 
         for i, prop in enumerate(stringifiable.properties):
             if isinstance(prop, Property):
-                value_str = dump(prop.value)
+                value_str = yield prop.value
+                assert value_str is not None
                 indention = "  "
                 writer.write(
                     f"  {prop.name}={indent_but_first_line(value_str, indention)}"
@@ -123,7 +132,8 @@ def dump(stringifiable: Stringifiable) -> str:
             writer = io.StringIO()
             writer.write("[\n")
             for i, value in enumerate(stringifiable):
-                value_str = dump(value)
+                value_str = yield value
+                assert value_str is not None
                 writer.write(textwrap.indent(value_str, "  "))
 
                 if i == len(stringifiable) - 1:
@@ -140,9 +150,11 @@ def dump(stringifiable: Stringifiable) -> str:
             writer = io.StringIO()
             writer.write("{\n")
             for i, (key, value) in enumerate(stringifiable.items()):
-                key_str = dump(key)
+                key_str = yield key
+                assert key_str is not None
 
-                value_str = dump(value)
+                value_str = yield value
+                assert value_str is not None
                 writer.write(textwrap.indent(f"{key_str}: {value_str}", "  "))
 
                 if i == len(stringifiable) - 1:
@@ -156,7 +168,8 @@ def dump(stringifiable: Stringifiable) -> str:
         return repr(None)
 
     elif isinstance(stringifiable, Property):
-        value_str = dump(stringifiable.value)
+        value_str = yield stringifiable.value
+        assert value_str is not None
         indention = ""
         return (
             f"Property("
@@ -174,23 +187,69 @@ def dump(stringifiable: Stringifiable) -> str:
     raise AssertionError("Should not have gotten here")
 
 
+def dump(stringifiable: Stringifiable) -> str:
+    """Produce a string representation of ``stringifiable`` for debugging or testing."""
+    # NOTE (mristin, 2022-07-12):
+    # We maintain an explicit stack of generators instead of recursing since
+    # the dumps of the large symbol tables came uncomfortably close to
+    # the recursion limit.
+    stack = [
+        _transcribe(stringifiable)
+    ]  # type: List[Generator[Stringifiable, Optional[str], str]]
+
+    rendered = None  # type: Optional[str]
+
+    while len(stack) > 0:
+        try:
+            child = stack[-1].send(rendered)
+            rendered = None
+            stack.append(_transcribe(child))
+        except StopIteration as stop:
+            stack.pop()
+            rendered = stop.value
+
+    assert rendered is not None
+    return rendered
+
+
+def _declared_property_set(obj: object) -> Set[str]:
+    """
+    Collect the public properties declared on the ``obj``.
+
+    The properties stored in the instance dictionary and the properties
+    declared through ``__slots__`` anywhere in the class hierarchy are both
+    considered. Mind that the dunders and "protected" properties are excluded.
+    """
+    result = {
+        key for key in getattr(obj, "__dict__", {}).keys() if not key.startswith("_")
+    }
+
+    for cls in type(obj).__mro__:
+        for name in getattr(cls, "__slots__", ()):
+            if not name.startswith("_") and hasattr(obj, name):
+                result.add(name)
+
+    return result
+
+
 def compares_against_dict(entity: Entity, obj: object) -> bool:
     """
-    Compare that the properties in the ``entity`` and ``obj.__dict__`` match.
+    Compare that the properties in the ``entity`` and the ``obj`` match.
 
     Mind that the dunders and "protected" properties are excluded.
     """
     entity_property_set = {prop.name for prop in entity.properties}
 
-    obj_property_set = {key for key in obj.__dict__.keys() if not key.startswith("_")}
-
-    return entity_property_set == obj_property_set
+    return entity_property_set == _declared_property_set(obj)
 
 
-@require(lambda obj: hasattr(obj, "__dict__"), error=ValueError)
+@require(
+    lambda obj: hasattr(obj, "__dict__") or hasattr(type(obj), "__slots__"),
+    error=ValueError,
+)
 def assert_compares_against_dict(entity: Entity, obj: object) -> None:
     """
-    Compare that the properties in the ``entity`` and ``obj.__dict__`` match.
+    Compare that the properties in the ``entity`` and the ``obj`` match.
 
     Mind that the dunders and "protected" properties are excluded.
     """
@@ -710,45 +710,114 @@ def _retrieve_implementation_specific_elements(
     return elements, None
 
 
-def _sort_by_tags_and_names_in_place(root: ET.Element) -> None:
+class _Definition:
+    """Represent a rendered top-level definition of the schema."""
+
+    def __init__(self, tag: str, name: Optional[str], text: str) -> None:
+        """Initialize with the given values."""
+        self.tag = tag
+        self.name = name
+        self.text = text
+
+
+def _render_envelope(envelope: ET.Element) -> Tuple[str, str]:
     """
-    Sort the children elements by tag and name attribute in place.
+    Render the header and the footer of the schema for the root ``envelope``.
 
-    This makes diffing and searching in the schema a bit easier.
+    The header includes the XML declaration and the opening tag of the root
+    element; the footer is the closing tag.
     """
-    groups = []  # type: List[ET.Element]
-    simple_types = []  # type: List[ET.Element]
-    complex_types = []  # type: List[ET.Element]
-    miscellaneous = []  # type: List[ET.Element]
-    elements = []  # type: List[ET.Element]
+    placeholder = ET.Element("placeholder")
+    envelope.append(placeholder)
+    text = ET.tostring(envelope, encoding="unicode", method="xml")
+    envelope.remove(placeholder)
 
-    for child in root:
-        if child.tag == "xs:group":
-            groups.append(child)
-        elif child.tag == "xs:simpleType":
-            simple_types.append(child)
-        elif child.tag == "xs:complexType":
-            complex_types.append(child)
-        elif child.tag == "xs:element":
-            elements.append(child)
-        else:
-            miscellaneous.append(child)
+    # noinspection PyUnresolvedReferences
+    pretty_text = xml.dom.minidom.parseString(text).toprettyxml(indent="  ")
+    lines = pretty_text.splitlines()
 
-    for element_list in [groups, simple_types, complex_types, miscellaneous, elements]:
-        element_list.sort(key=lambda elt: elt.attrib.get("name", ""))
+    return f"{lines[0]}\n{lines[1]}\n", f"{lines[-1]}\n"
 
-    children = groups + simple_types + complex_types + elements + miscellaneous
 
-    assert len(children) == len(root)
-    root[:] = children
+def _render_definition(envelope: ET.Element, element: ET.Element) -> str:
+    """
+    Render the ``element`` as a pretty-printed fragment of the schema.
+
+    The ``element`` is temporarily inserted in the ``envelope`` so that the
+    namespace declarations of the root element apply during the rendering.
+    The resulting fragment is indented as a child of the root element.
+    """
+    envelope.append(element)
+    text = ET.tostring(envelope, encoding="unicode", method="xml")
+    envelope.remove(element)
+
+    # noinspection PyUnresolvedReferences
+    pretty_text = xml.dom.minidom.parseString(text).toprettyxml(indent="  ")
+    lines = pretty_text.splitlines()
+
+    return "\n".join(lines[2:-1]) + "\n"
+
+
+def _sort_by_tags_and_names(definitions: List[_Definition]) -> List[_Definition]:
+    """
+    Sort the definitions by tag and name attribute.
+
+    This makes diffing and searching in the schema a bit easier.
+    """
+    groups = []  # type: List[_Definition]
+    simple_types = []  # type: List[_Definition]
+    complex_types = []  # type: List[_Definition]
+    miscellaneous = []  # type: List[_Definition]
+    elements = []  # type: List[_Definition]
+
+    for definition in definitions:
+        if definition.tag == "xs:group":
+            groups.append(definition)
+        elif definition.tag == "xs:simpleType":
+            simple_types.append(definition)
+        elif definition.tag == "xs:complexType":
+            complex_types.append(definition)
+        elif definition.tag == "xs:element":
+            elements.append(definition)
+        else:
+            miscellaneous.append(definition)
+
+    for definition_list in [
+        groups,
+        simple_types,
+        complex_types,
+        miscellaneous,
+        elements,
+    ]:
+        definition_list.sort(
+            key=lambda definition: (
+                definition.name if definition.name is not None else ""
+            )
+        )
+
+    result = groups + simple_types + complex_types + elements + miscellaneous
+
+    assert len(result) == len(definitions)
+    return result
 
 
 @ensure(lambda result: (result[0] is not None) ^ (result[1] is not None))
 def _generate(
     symbol_table: intermediate.SymbolTable,
     spec_impls: specific_implementations.SpecificImplementations,
-) -> Tuple[Optional[str], Optional[List[Error]]]:
-    """Generate the XML Schema Definition (XSD) based on the ``symbol_table."""
+    constraints_by_class: MutableMapping[
+        intermediate.ClassUnion, infer_for_schema.ConstraintsByProperty
+    ],
+) -> Tuple[Optional[List[str]], Optional[List[Error]]]:
+    """
+    Generate the XML Schema Definition (XSD) based on the ``symbol_table``.
+
+    The schema is returned as a list of pretty-printed chunks which the caller
+    is expected to write to the output in order. Each definition is rendered
+    to text as soon as its class is processed and the element tree is
+    discarded immediately, so the memory consumption stays flat in the size
+    of the meta-model instead of holding the whole schema as element objects.
+    """
     root_element_key = specific_implementations.ImplementationKey("root_element.xml")
 
     root_element_as_text = spec_impls.get(root_element_key, None)
@@ -814,22 +883,33 @@ def _generate(
     if len(errors) > 0:
         return None, errors
 
-    constraints_by_class, some_errors = infer_for_schema.infer_constraints_by_class(
-        symbol_table=symbol_table
-    )
-
-    if some_errors is not None:
-        errors.extend(some_errors)
-
-    if len(errors) > 0:
-        return None, errors
-
-    assert constraints_by_class is not None
-
     ids_of_our_types_in_properties = (
         intermediate.collect_ids_of_our_types_in_properties(symbol_table=symbol_table)
     )
 
+    # NOTE (mristin, 2022-03-30):
+    # For some unknown reason, ElementTree erases the xmlns property of the root
+    # element. Therefore, we need to add it here manually.
+    root.attrib["xmlns"] = xmlns
+
+    # NOTE (mristin, 2022-06-11):
+    # We use the root element as an envelope to render the individual
+    # definitions one by one, so we detach its original children and treat
+    # them as the first definitions.
+    initial_elements = list(root)
+    for initial_element in initial_elements:
+        root.remove(initial_element)
+
+    definitions = []  # type: List[_Definition]
+    for initial_element in initial_elements:
+        definitions.append(
+            _Definition(
+                tag=initial_element.tag,
+                name=initial_element.attrib.get("name", None),
+                text=_render_definition(envelope=root, element=initial_element),
+            )
+        )
+
     for our_type in symbol_table.our_types:
         elements = None  # type: Optional[List[ET.Element]]
 
@@ -883,72 +963,87 @@ def _generate(
                 assert_never(our_type)
 
         assert elements is not None
-        root.extend(elements)
+        for element in elements:
+            definitions.append(
+                _Definition(
+                    tag=element.tag,
+                    name=element.attrib.get("name", None),
+                    text=_render_definition(envelope=root, element=element),
+                )
+            )
 
     if len(errors) > 0:
         return None, errors
 
-    # Tag name 🠒 (name 🠒 element)
+    # Tag name -> (name -> definition)
     observed_definitions = dict(
         dict()
-    )  # type: MutableMapping[str, MutableMapping[str, ET.Element]]
+    )  # type: MutableMapping[str, MutableMapping[str, _Definition]]
 
-    for element in root:
-        name = element.attrib.get("name", None)
-        if name is None:
+    for definition in definitions:
+        if definition.name is None:
             continue
 
-        observed_for_tag = observed_definitions.get(element.tag, None)
+        observed_for_tag = observed_definitions.get(definition.tag, None)
         if observed_for_tag is None:
             observed_for_tag = dict()
-            observed_definitions[element.tag] = observed_for_tag
-
-        observed_element = observed_for_tag.get(name, None)
-        if observed_element is not None:
-            ours = ET.tostring(element, encoding="unicode", method="xml")
-            theirs = ET.tostring(observed_element, encoding="unicode", method="xml")
+            observed_definitions[definition.tag] = observed_for_tag
 
+        observed_definition = observed_for_tag.get(definition.name, None)
+        if observed_definition is not None:
             errors.append(
                 Error(
                     None,
                     f"There are conflicting definitions in the schema "
-                    f"with the name {name!r}:\n"
+                    f"with the name {definition.name!r}:\n"
                     f"\n"
-                    f"{ours}\n"
+                    f"{definition.text}\n"
                     f"\n"
                     f"and\n"
                     f"\n"
-                    f"{theirs}",
+                    f"{observed_definition.text}",
                 )
             )
         else:
-            observed_for_tag[name] = element
+            observed_for_tag[definition.name] = definition
 
     if len(errors) > 0:
         return None, errors
 
-    _sort_by_tags_and_names_in_place(root)
+    sorted_definitions = _sort_by_tags_and_names(definitions)
 
-    # NOTE (mristin, 2022-03-30):
-    # For some unknown reason, ElementTree erases the xmlns property of the root
-    # element. Therefore, we need to add it here manually.
-    root.attrib["xmlns"] = xmlns
+    header, footer = _render_envelope(envelope=root)
 
-    text = ET.tostring(root, encoding="unicode", method="xml")
-
-    # NOTE (mristin, 2021-11-23):
-    # This approach is slow, but effective. As long as the meta-model is not too big,
-    # this should work.
-    # noinspection PyUnresolvedReferences
-    pretty_text = xml.dom.minidom.parseString(text).toprettyxml(indent="  ")
+    chunks = [header]
+    for definition in sorted_definitions:
+        chunks.append(definition.text)
+    chunks.append(footer)
 
-    return pretty_text, None
+    return chunks, None
 
 
 def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
     """Generate the code."""
-    code, errors = _generate(
-        symbol_table=context.symbol_table, spec_impls=context.spec_impls
+    # NOTE (mristin, 2022-07-12):
+    # The constraint inference is shared over the context so that the schema
+    # targets do not infer the same constraints thrice in a multi-target run.
+    constraints_by_class, errors = context.infer_constraints_by_class()
+
+    if errors is not None:
+        run.write_error_report(
+            message=f"Failed to infer the constraints for the XML Schema Definition "
+            f"based on {context.model_path}",
+            errors=[context.lineno_columner.error_message(error) for error in errors],
+            stderr=stderr,
+        )
+        return 1
+
+    assert constraints_by_class is not None
+
+    chunks, errors = _generate(
+        symbol_table=context.symbol_table,
+        spec_impls=context.spec_impls,
+        constraints_by_class=constraints_by_class,
     )
 
     if errors is not None:
@@ -960,11 +1055,11 @@ def execute(context: run.Context, stdout: TextIO, stderr: TextIO) -> int:
         )
         return 1
 
-    assert code is not None
+    assert chunks is not None
 
     pth = context.output_dir / "schema.xsd"
     try:
-        pth.write_text(code, encoding="utf-8")
+        run.write_if_different(pth, chunks)
     except Exception as exception:
         run.write_error_report(
             message=f"Failed to write the XML Schema Definition to {pth}",
@@ -5,9 +5,12 @@ The identifiers are based on the meta-model. Unlike
 :py:mod:`aas_core_codegen.naming`, which are used with different generators,
 these identifiers are used only for the XSD.
 """
+import functools
+
 from aas_core_codegen.common import Identifier
 
 
+@functools.lru_cache(maxsize=None)
 def type_name(identifier: Identifier) -> Identifier:
     """
     Generate the XML type name for the given class based on its ``identifier``.
@@ -33,6 +36,7 @@ def type_name(identifier: Identifier) -> Identifier:
     )
 
 
+@functools.lru_cache(maxsize=None)
 def group_name(identifier: Identifier) -> Identifier:
     """
     Generate the XML group name for the given class based on its ``identifier``.
@@ -58,6 +62,7 @@ def group_name(identifier: Identifier) -> Identifier:
     )
 
 
+@functools.lru_cache(maxsize=None)
 def choice_group_name(identifier: Identifier) -> Identifier:
     """
     Generate the XML group name for the interface of the given class ``identifier``.
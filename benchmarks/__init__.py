@@ -0,0 +1 @@
+"""Benchmark the generation pipeline and guard against performance regressions."""
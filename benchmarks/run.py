@@ -0,0 +1,339 @@
+"""Benchmark the generation pipeline over real and synthetic meta-models.
+
+The harness measures the individual phases — parsing, the intermediate
+translation, the schema constraint inference and, where the snippets are
+available, the full target generation — and compares the wall times against
+a previously recorded baseline. The run fails if a phase regressed beyond
+the given threshold so that performance work remains measurable in CI.
+
+Record the baseline on the reference machine first::
+
+    python3 -m benchmarks.run --baseline benchmarks/baseline.json --record
+
+and check against it on the consecutive runs::
+
+    python3 -m benchmarks.run --baseline benchmarks/baseline.json
+"""
+
+import argparse
+import io
+import json
+import pathlib
+import sys
+import tempfile
+from typing import List, Mapping, MutableMapping, Optional, Tuple
+
+from aas_core_codegen import infer_for_schema, intermediate, parse, profiling
+
+import aas_core_codegen.main
+
+from benchmarks import synthesize
+
+#: Class counts of the synthetically scaled meta-models which we benchmark
+SYNTHETIC_CLASS_COUNTS = [100, 400]
+
+#: Wall times of the phases of a single benchmark case, mapping
+#: the phase name to the best-of-``repeat`` wall time in seconds
+PhaseTimes = Mapping[str, float]
+
+
+def _translate_measured(
+    text: str, profiler: profiling.Profiler
+) -> Optional[intermediate.SymbolTable]:
+    """
+    Parse and translate the meta-model ``text``, measuring the phases.
+
+    :return: the translated symbol table, or None if the translation failed
+    """
+    with profiler.measure("parse.source_to_atok"):
+        atok, parse_exception = parse.source_to_atok(source=text)
+
+    if parse_exception is not None:
+        return None
+
+    assert atok is not None
+
+    with profiler.measure("parse.atok_to_symbol_table"):
+        parsed_symbol_table, error = parse.atok_to_symbol_table(atok=atok)
+
+    if error is not None:
+        return None
+
+    assert parsed_symbol_table is not None
+
+    with profiler.measure("intermediate.translate"):
+        ir_symbol_table, error = intermediate.translate(
+            parsed_symbol_table=parsed_symbol_table, atok=atok
+        )
+
+    if error is not None:
+        return None
+
+    assert ir_symbol_table is not None
+
+    with profiler.measure("infer_for_schema.infer_constraints_by_class"):
+        _, _ = infer_for_schema.infer_constraints_by_class(
+            symbol_table=ir_symbol_table
+        )
+
+    return ir_symbol_table
+
+
+def _benchmark_translation(text: str, repeat: int) -> Optional[PhaseTimes]:
+    """
+    Measure the translation phases over the meta-model ``text``.
+
+    The phases are repeated ``repeat`` times and the best wall time is taken
+    so that the measurements are less sensitive to the machine noise.
+
+    :return: the wall times by phase, or None if the translation failed
+    """
+    best = dict()  # type: MutableMapping[str, float]
+
+    for _ in range(repeat):
+        profiler = profiling.Profiler()
+
+        if _translate_measured(text=text, profiler=profiler) is None:
+            return None
+
+        for record in profiler.records:
+            previous = best.get(record.name, None)
+            if previous is None or record.wall_time < previous:
+                best[record.name] = record.wall_time
+
+    return best
+
+
+def _benchmark_targets(
+    model_path: pathlib.Path, repo_dir: pathlib.Path, repeat: int
+) -> Tuple[PhaseTimes, List[str]]:
+    """
+    Measure the full generation for every target with the recorded snippets.
+
+    The snippets are taken from the corresponding ``test_data`` case
+    directories; targets without the recorded snippets are skipped.
+
+    :return: the wall times by phase and the error messages, if any
+    """
+    test_data_dir_by_target = {
+        aas_core_codegen.main.Target.CSHARP: "csharp",
+        aas_core_codegen.main.Target.JSONSCHEMA: "jsonschema",
+        aas_core_codegen.main.Target.RDF_SHACL: "rdf_shacl",
+        aas_core_codegen.main.Target.XSD: "xsd",
+    }
+
+    best = dict()  # type: MutableMapping[str, float]
+    errors = []  # type: List[str]
+
+    for target, test_data_dir in test_data_dir_by_target.items():
+        snippets_dir = (
+            repo_dir
+            / "test_data"
+            / test_data_dir
+            / "test_main"
+            / model_path.stem
+            / "input"
+            / "snippets"
+        )
+
+        if not snippets_dir.is_dir():
+            continue
+
+        for _ in range(repeat):
+            with tempfile.TemporaryDirectory() as tmp_dir:
+                params = aas_core_codegen.main.Parameters(
+                    model_path=model_path,
+                    target=target,
+                    snippets_dir=snippets_dir,
+                    output_dir=pathlib.Path(tmp_dir),
+                )
+
+                stdout = io.StringIO()
+                stderr = io.StringIO()
+
+                profiler = profiling.Profiler()
+                with profiler.measure(f"{target.value}.execute"):
+                    exit_code = aas_core_codegen.main.execute(
+                        params=params, stdout=stdout, stderr=stderr
+                    )
+
+                if exit_code != 0:
+                    errors.append(
+                        f"The target {target.value} failed "
+                        f"on {model_path}:\n{stderr.getvalue()}"
+                    )
+                    break
+
+                record = profiler.records[0]
+                previous = best.get(record.name, None)
+                if previous is None or record.wall_time < previous:
+                    best[record.name] = record.wall_time
+
+    return best, errors
+
+
+def _check_against_baseline(
+    measurements: Mapping[str, PhaseTimes],
+    baseline: Mapping[str, PhaseTimes],
+    threshold: float,
+) -> List[str]:
+    """
+    Compare the ``measurements`` against the ``baseline``.
+
+    Phases missing in the baseline are ignored so that new benchmark cases
+    can be introduced without invalidating the recorded baseline.
+
+    :return: the list of regressions, if any
+    """
+    regressions = []  # type: List[str]
+
+    for case, phase_times in measurements.items():
+        baseline_phase_times = baseline.get(case, None)
+        if baseline_phase_times is None:
+            continue
+
+        for phase, wall_time in phase_times.items():
+            baseline_wall_time = baseline_phase_times.get(phase, None)
+            if baseline_wall_time is None:
+                continue
+
+            if wall_time > baseline_wall_time * threshold:
+                regressions.append(
+                    f"{case}: {phase} took {wall_time:.4f} s, "
+                    f"more than {threshold:.2f}x the baseline "
+                    f"of {baseline_wall_time:.4f} s"
+                )
+
+    return regressions
+
+
+def main() -> int:
+    """Execute the main routine."""
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--baseline",
+        help="path to the baseline JSON with the recorded wall times",
+        required=True,
+    )
+    parser.add_argument(
+        "--record",
+        help="record the measurements as the new baseline instead of comparing",
+        action="store_true",
+    )
+    parser.add_argument(
+        "--threshold",
+        help=(
+            "maximum allowed slowdown of a phase relative to the baseline "
+            "before the run is considered a regression"
+        ),
+        type=float,
+        default=1.5,
+    )
+    parser.add_argument(
+        "--repeat",
+        help="number of repetitions of each measurement; the best time is taken",
+        type=int,
+        default=3,
+    )
+    args = parser.parse_args()
+
+    repo_dir = pathlib.Path(__file__).parent.parent
+
+    measurements = dict()  # type: MutableMapping[str, PhaseTimes]
+
+    # region Real meta-models
+
+    # NOTE (mristin, 2022-06-11):
+    # The real meta-models come from the ``aas-core-meta`` package. We skip
+    # them gracefully if the package is not installed so that the synthetic
+    # benchmarks still run in minimal environments.
+    try:
+        # pylint: disable=import-outside-toplevel
+        import aas_core_meta.v3rc2
+
+        meta_modules = [aas_core_meta.v3rc2]
+    except ImportError:
+        meta_modules = []
+        print("The package aas-core-meta is not installed; skipping its models.")
+
+    for module in meta_modules:
+        assert module.__file__ is not None
+        model_path = pathlib.Path(module.__file__)
+
+        text = model_path.read_text(encoding="utf-8")
+
+        phase_times = _benchmark_translation(text=text, repeat=args.repeat)
+        if phase_times is None:
+            print(f"Failed to translate the meta-model: {model_path}")
+            return 1
+
+        target_times, errors = _benchmark_targets(
+            model_path=model_path, repo_dir=repo_dir, repeat=args.repeat
+        )
+        if errors:
+            for error in errors:
+                print(error, file=sys.stderr)
+            return 1
+
+        measurements[module.__name__] = {**phase_times, **target_times}
+
+    # endregion
+
+    # region Synthetic meta-models
+
+    for class_count in SYNTHETIC_CLASS_COUNTS:
+        text = synthesize.generate(class_count=class_count)
+
+        phase_times = _benchmark_translation(text=text, repeat=args.repeat)
+        if phase_times is None:
+            print(
+                f"Failed to translate the synthetic meta-model "
+                f"with {class_count} classes"
+            )
+            return 1
+
+        measurements[f"synthetic_{class_count}"] = phase_times
+
+    # endregion
+
+    for case, phase_times in measurements.items():
+        print(f"{case}:")
+        for phase, wall_time in phase_times.items():
+            print(f"  {phase}: {wall_time:.4f} s")
+
+    baseline_path = pathlib.Path(args.baseline)
+
+    if args.record:
+        baseline_path.write_text(
+            json.dumps(measurements, indent=2, sort_keys=True) + "\n",
+            encoding="utf-8",
+        )
+        print(f"Recorded the baseline to: {baseline_path}")
+        return 0
+
+    if not baseline_path.exists():
+        print(
+            f"The baseline does not exist: {baseline_path}; "
+            f"record it first with --record",
+            file=sys.stderr,
+        )
+        return 1
+
+    baseline = json.loads(baseline_path.read_text(encoding="utf-8"))
+
+    regressions = _check_against_baseline(
+        measurements=measurements, baseline=baseline, threshold=args.threshold
+    )
+
+    if regressions:
+        print("Performance regressions detected:", file=sys.stderr)
+        for regression in regressions:
+            print(f"  {regression}", file=sys.stderr)
+        return 1
+
+    print("No performance regressions detected.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,118 @@
+"""Synthesize a scaled meta-model for benchmarking purposes.
+
+The real test meta-models are fairly small so that the translation finishes in
+milliseconds. To make the phases measurable and to catch super-linear behavior,
+we generate a meta-model with an arbitrary number of classes which still
+exercises the usual features: inheritance, enumerations, descriptions,
+invariants, optional and subscripted type annotations and cross-references
+between the classes.
+"""
+
+import argparse
+import pathlib
+import sys
+from typing import List
+
+from icontract import require
+
+
+@require(lambda class_count: class_count > 0)
+def generate(class_count: int) -> str:
+    """Generate the source code of a meta-model with ``class_count`` classes."""
+    blocks = [
+        '''\
+@abstract
+class Base:
+    """Represent the common ancestor of all the synthetic classes."""
+
+    name: str
+    """Identify the instance within its container."""
+
+    @require(lambda name: len(name) > 0)
+    def __init__(self, name: str) -> None:
+        self.name = name'''
+    ]  # type: List[str]
+
+    for i in range(class_count):
+        # NOTE (mristin, 2022-06-11):
+        # Every tenth symbol is an enumeration so that the ratio between
+        # the enumerations and the classes roughly mirrors the real
+        # meta-models.
+        if i % 10 == 9:
+            literals = "\n\n".join(
+                f'    literal_{j} = "Literal-{j}"' for j in range(5)
+            )
+            blocks.append(
+                f'''\
+class Enum_{i}(Enum):
+    """Enumerate the synthetic literals {i}."""
+
+{literals}'''
+            )
+            continue
+
+        properties = [
+            "    count: int",
+            '    text: str\n    """Capture some text."""',
+        ]
+        init_args = ["count: int", "text: str"]
+        init_body = ["self.count = count", "self.text = text"]
+
+        if i > 0 and (i - 1) % 10 != 9:
+            properties.append(f"    items: Optional[List[Thing_{i - 1}]]")
+            init_args.append(f"items: Optional[List[Thing_{i - 1}]] = None")
+            init_body.append("self.items = items")
+
+        properties_joined = "\n\n".join(properties)
+        init_args_joined = ",\n        ".join(["name: str"] + init_args)
+        init_body_joined = "\n        ".join(init_body)
+
+        blocks.append(
+            f'''\
+@invariant(lambda self: len(self.text) >= 1)
+class Thing_{i}(Base):
+    """Represent the synthetic thing {i}."""
+
+{properties_joined}
+
+    @require(lambda count: count >= 0)
+    def __init__(
+        self,
+        {init_args_joined}
+    ) -> None:
+        Base.__init__(self, name)
+        {init_body_joined}'''
+        )
+
+    blocks.append(
+        '''\
+__book_url__ = "dummy"
+__book_version__ = "dummy"'''
+    )
+
+    return "\n\n\n".join(blocks) + "\n"
+
+
+def main() -> int:
+    """Execute the main routine."""
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--class_count",
+        help="number of classes in the synthesized meta-model",
+        type=int,
+        default=300,
+    )
+    parser.add_argument(
+        "--output", help="path to the synthesized meta-model", required=True
+    )
+    args = parser.parse_args()
+
+    pathlib.Path(args.output).write_text(
+        generate(class_count=args.class_count), encoding="utf-8"
+    )
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
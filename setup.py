@@ -61,6 +61,7 @@ setup(
         "console_scripts": [
             "aas-core-codegen=aas_core_codegen.main:entry_point",
             "aas-core-codegen-smoke=aas_core_codegen.smoke.main:entry_point",
+            "aas-core-codegen-compile=aas_core_codegen.compile_ir.main:entry_point",
         ]
     },
 )
@@ -4,6 +4,7 @@
  */
 
 using CodeAnalysis = System.Diagnostics.CodeAnalysis;
+using Json = System.Text.Json;
 using Nodes = System.Text.Json.Nodes;
 using System.Collections.Generic;  // can't alias
 
@@ -38,6 +39,17 @@ namespace AasCore.Aas3_0_RC02
         /// </remarks>
         internal static class DeserializeImplementation
         {
+            /// <summary>
+            /// Deserialize an instance of <typeparamref name="T" />
+            /// from <paramref name="node" />.
+            /// </summary>
+            /// <param name="node">JSON node to be parsed</param>
+            /// <param name="error">Error, if any, during the deserialization</param>
+            /// <typeparam name="T">type of the deserialized instance</typeparam>
+            internal delegate T? DeserializeDelegate<out T>(
+                Nodes.JsonNode node,
+                out Reporting.Error? error) where T : class;
+
             /// <summary>Convert <paramref name="node" /> to a boolean.</summary>
             /// <param name="node">JSON node to be parsed</param>
             /// <param name="error">Error, if any, during the deserialization</param>
@@ -199,6 +211,33 @@ namespace AasCore.Aas3_0_RC02
                 }
             }
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for IHasSemantics.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.IHasSemantics>>
+                _hasSemanticsFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.IHasSemantics>>()
+                    {
+                        { "RelationshipElement", RelationshipElementFrom },
+                        { "AnnotatedRelationshipElement", AnnotatedRelationshipElementFrom },
+                        { "BasicEventElement", BasicEventElementFrom },
+                        { "Blob", BlobFrom },
+                        { "Capability", CapabilityFrom },
+                        { "Entity", EntityFrom },
+                        { "Extension", ExtensionFrom },
+                        { "File", FileFrom },
+                        { "MultiLanguageProperty", MultiLanguagePropertyFrom },
+                        { "Operation", OperationFrom },
+                        { "Property", PropertyFrom },
+                        { "Qualifier", QualifierFrom },
+                        { "Range", RangeFrom },
+                        { "ReferenceElement", ReferenceElementFrom },
+                        { "SpecificAssetId", SpecificAssetIdFrom },
+                        { "Submodel", SubmodelFrom },
+                        { "SubmodelElementCollection", SubmodelElementCollectionFrom },
+                        { "SubmodelElementList", SubmodelElementListFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of IHasSemantics by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -244,67 +283,15 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
-                {
-                    case "RelationshipElement":
-                        return RelationshipElementFrom(
-                            node, out error);
-                    case "AnnotatedRelationshipElement":
-                        return AnnotatedRelationshipElementFrom(
-                            node, out error);
-                    case "BasicEventElement":
-                        return BasicEventElementFrom(
-                            node, out error);
-                    case "Blob":
-                        return BlobFrom(
-                            node, out error);
-                    case "Capability":
-                        return CapabilityFrom(
-                            node, out error);
-                    case "Entity":
-                        return EntityFrom(
-                            node, out error);
-                    case "Extension":
-                        return ExtensionFrom(
-                            node, out error);
-                    case "File":
-                        return FileFrom(
-                            node, out error);
-                    case "MultiLanguageProperty":
-                        return MultiLanguagePropertyFrom(
-                            node, out error);
-                    case "Operation":
-                        return OperationFrom(
-                            node, out error);
-                    case "Property":
-                        return PropertyFrom(
-                            node, out error);
-                    case "Qualifier":
-                        return QualifierFrom(
-                            node, out error);
-                    case "Range":
-                        return RangeFrom(
-                            node, out error);
-                    case "ReferenceElement":
-                        return ReferenceElementFrom(
-                            node, out error);
-                    case "SpecificAssetId":
-                        return SpecificAssetIdFrom(
-                            node, out error);
-                    case "Submodel":
-                        return SubmodelFrom(
-                            node, out error);
-                    case "SubmodelElementCollection":
-                        return SubmodelElementCollectionFrom(
-                            node, out error);
-                    case "SubmodelElementList":
-                        return SubmodelElementListFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for IHasSemantics: {modelType}");
-                        return null;
+                if (!_hasSemanticsFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.IHasSemantics>? fromMethod))
+                {
+                    error = new Reporting.Error(
+                        $"Unexpected model type for IHasSemantics: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.IHasSemantics IHasSemanticsFrom
 
             /// <summary>
@@ -537,6 +524,32 @@ namespace AasCore.Aas3_0_RC02
                     theRefersTo);
             }  // internal static ExtensionFrom
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for IHasExtensions.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.IHasExtensions>>
+                _hasExtensionsFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.IHasExtensions>>()
+                    {
+                        { "RelationshipElement", RelationshipElementFrom },
+                        { "AnnotatedRelationshipElement", AnnotatedRelationshipElementFrom },
+                        { "AssetAdministrationShell", AssetAdministrationShellFrom },
+                        { "BasicEventElement", BasicEventElementFrom },
+                        { "Blob", BlobFrom },
+                        { "Capability", CapabilityFrom },
+                        { "ConceptDescription", ConceptDescriptionFrom },
+                        { "Entity", EntityFrom },
+                        { "File", FileFrom },
+                        { "MultiLanguageProperty", MultiLanguagePropertyFrom },
+                        { "Operation", OperationFrom },
+                        { "Property", PropertyFrom },
+                        { "Range", RangeFrom },
+                        { "ReferenceElement", ReferenceElementFrom },
+                        { "Submodel", SubmodelFrom },
+                        { "SubmodelElementCollection", SubmodelElementCollectionFrom },
+                        { "SubmodelElementList", SubmodelElementListFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of IHasExtensions by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -582,66 +595,43 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
-                {
-                    case "RelationshipElement":
-                        return RelationshipElementFrom(
-                            node, out error);
-                    case "AnnotatedRelationshipElement":
-                        return AnnotatedRelationshipElementFrom(
-                            node, out error);
-                    case "AssetAdministrationShell":
-                        return AssetAdministrationShellFrom(
-                            node, out error);
-                    case "BasicEventElement":
-                        return BasicEventElementFrom(
-                            node, out error);
-                    case "Blob":
-                        return BlobFrom(
-                            node, out error);
-                    case "Capability":
-                        return CapabilityFrom(
-                            node, out error);
-                    case "ConceptDescription":
-                        return ConceptDescriptionFrom(
-                            node, out error);
-                    case "Entity":
-                        return EntityFrom(
-                            node, out error);
-                    case "File":
-                        return FileFrom(
-                            node, out error);
-                    case "MultiLanguageProperty":
-                        return MultiLanguagePropertyFrom(
-                            node, out error);
-                    case "Operation":
-                        return OperationFrom(
-                            node, out error);
-                    case "Property":
-                        return PropertyFrom(
-                            node, out error);
-                    case "Range":
-                        return RangeFrom(
-                            node, out error);
-                    case "ReferenceElement":
-                        return ReferenceElementFrom(
-                            node, out error);
-                    case "Submodel":
-                        return SubmodelFrom(
-                            node, out error);
-                    case "SubmodelElementCollection":
-                        return SubmodelElementCollectionFrom(
-                            node, out error);
-                    case "SubmodelElementList":
-                        return SubmodelElementListFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for IHasExtensions: {modelType}");
-                        return null;
+                if (!_hasExtensionsFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.IHasExtensions>? fromMethod))
+                {
+                    error = new Reporting.Error(
+                        $"Unexpected model type for IHasExtensions: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.IHasExtensions IHasExtensionsFrom
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for IReferable.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.IReferable>>
+                _referableFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.IReferable>>()
+                    {
+                        { "RelationshipElement", RelationshipElementFrom },
+                        { "AnnotatedRelationshipElement", AnnotatedRelationshipElementFrom },
+                        { "AssetAdministrationShell", AssetAdministrationShellFrom },
+                        { "BasicEventElement", BasicEventElementFrom },
+                        { "Blob", BlobFrom },
+                        { "Capability", CapabilityFrom },
+                        { "ConceptDescription", ConceptDescriptionFrom },
+                        { "Entity", EntityFrom },
+                        { "File", FileFrom },
+                        { "MultiLanguageProperty", MultiLanguagePropertyFrom },
+                        { "Operation", OperationFrom },
+                        { "Property", PropertyFrom },
+                        { "Range", RangeFrom },
+                        { "ReferenceElement", ReferenceElementFrom },
+                        { "Submodel", SubmodelFrom },
+                        { "SubmodelElementCollection", SubmodelElementCollectionFrom },
+                        { "SubmodelElementList", SubmodelElementListFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of IReferable by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -687,66 +677,29 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
-                {
-                    case "RelationshipElement":
-                        return RelationshipElementFrom(
-                            node, out error);
-                    case "AnnotatedRelationshipElement":
-                        return AnnotatedRelationshipElementFrom(
-                            node, out error);
-                    case "AssetAdministrationShell":
-                        return AssetAdministrationShellFrom(
-                            node, out error);
-                    case "BasicEventElement":
-                        return BasicEventElementFrom(
-                            node, out error);
-                    case "Blob":
-                        return BlobFrom(
-                            node, out error);
-                    case "Capability":
-                        return CapabilityFrom(
-                            node, out error);
-                    case "ConceptDescription":
-                        return ConceptDescriptionFrom(
-                            node, out error);
-                    case "Entity":
-                        return EntityFrom(
-                            node, out error);
-                    case "File":
-                        return FileFrom(
-                            node, out error);
-                    case "MultiLanguageProperty":
-                        return MultiLanguagePropertyFrom(
-                            node, out error);
-                    case "Operation":
-                        return OperationFrom(
-                            node, out error);
-                    case "Property":
-                        return PropertyFrom(
-                            node, out error);
-                    case "Range":
-                        return RangeFrom(
-                            node, out error);
-                    case "ReferenceElement":
-                        return ReferenceElementFrom(
-                            node, out error);
-                    case "Submodel":
-                        return SubmodelFrom(
-                            node, out error);
-                    case "SubmodelElementCollection":
-                        return SubmodelElementCollectionFrom(
-                            node, out error);
-                    case "SubmodelElementList":
-                        return SubmodelElementListFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for IReferable: {modelType}");
-                        return null;
+                if (!_referableFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.IReferable>? fromMethod))
+                {
+                    error = new Reporting.Error(
+                        $"Unexpected model type for IReferable: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.IReferable IReferableFrom
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for IIdentifiable.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.IIdentifiable>>
+                _identifiableFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.IIdentifiable>>()
+                    {
+                        { "AssetAdministrationShell", AssetAdministrationShellFrom },
+                        { "ConceptDescription", ConceptDescriptionFrom },
+                        { "Submodel", SubmodelFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of IIdentifiable by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -792,22 +745,15 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
+                if (!_identifiableFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.IIdentifiable>? fromMethod))
                 {
-                    case "AssetAdministrationShell":
-                        return AssetAdministrationShellFrom(
-                            node, out error);
-                    case "ConceptDescription":
-                        return ConceptDescriptionFrom(
-                            node, out error);
-                    case "Submodel":
-                        return SubmodelFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for IIdentifiable: {modelType}");
-                        return null;
+                    error = new Reporting.Error(
+                        $"Unexpected model type for IIdentifiable: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.IIdentifiable IIdentifiableFrom
 
             /// <summary>
@@ -840,6 +786,30 @@ namespace AasCore.Aas3_0_RC02
                 return result;
             }  // internal static ModelingKindFrom
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for IHasKind.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.IHasKind>>
+                _hasKindFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.IHasKind>>()
+                    {
+                        { "RelationshipElement", RelationshipElementFrom },
+                        { "AnnotatedRelationshipElement", AnnotatedRelationshipElementFrom },
+                        { "BasicEventElement", BasicEventElementFrom },
+                        { "Blob", BlobFrom },
+                        { "Capability", CapabilityFrom },
+                        { "Entity", EntityFrom },
+                        { "File", FileFrom },
+                        { "MultiLanguageProperty", MultiLanguagePropertyFrom },
+                        { "Operation", OperationFrom },
+                        { "Property", PropertyFrom },
+                        { "Range", RangeFrom },
+                        { "ReferenceElement", ReferenceElementFrom },
+                        { "Submodel", SubmodelFrom },
+                        { "SubmodelElementCollection", SubmodelElementCollectionFrom },
+                        { "SubmodelElementList", SubmodelElementListFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of IHasKind by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -885,60 +855,44 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
-                {
-                    case "RelationshipElement":
-                        return RelationshipElementFrom(
-                            node, out error);
-                    case "AnnotatedRelationshipElement":
-                        return AnnotatedRelationshipElementFrom(
-                            node, out error);
-                    case "BasicEventElement":
-                        return BasicEventElementFrom(
-                            node, out error);
-                    case "Blob":
-                        return BlobFrom(
-                            node, out error);
-                    case "Capability":
-                        return CapabilityFrom(
-                            node, out error);
-                    case "Entity":
-                        return EntityFrom(
-                            node, out error);
-                    case "File":
-                        return FileFrom(
-                            node, out error);
-                    case "MultiLanguageProperty":
-                        return MultiLanguagePropertyFrom(
-                            node, out error);
-                    case "Operation":
-                        return OperationFrom(
-                            node, out error);
-                    case "Property":
-                        return PropertyFrom(
-                            node, out error);
-                    case "Range":
-                        return RangeFrom(
-                            node, out error);
-                    case "ReferenceElement":
-                        return ReferenceElementFrom(
-                            node, out error);
-                    case "Submodel":
-                        return SubmodelFrom(
-                            node, out error);
-                    case "SubmodelElementCollection":
-                        return SubmodelElementCollectionFrom(
-                            node, out error);
-                    case "SubmodelElementList":
-                        return SubmodelElementListFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for IHasKind: {modelType}");
-                        return null;
+                if (!_hasKindFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.IHasKind>? fromMethod))
+                {
+                    error = new Reporting.Error(
+                        $"Unexpected model type for IHasKind: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.IHasKind IHasKindFrom
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for IHasDataSpecification.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.IHasDataSpecification>>
+                _hasDataSpecificationFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.IHasDataSpecification>>()
+                    {
+                        { "AdministrativeInformation", AdministrativeInformationFrom },
+                        { "RelationshipElement", RelationshipElementFrom },
+                        { "AnnotatedRelationshipElement", AnnotatedRelationshipElementFrom },
+                        { "AssetAdministrationShell", AssetAdministrationShellFrom },
+                        { "BasicEventElement", BasicEventElementFrom },
+                        { "Blob", BlobFrom },
+                        { "Capability", CapabilityFrom },
+                        { "ConceptDescription", ConceptDescriptionFrom },
+                        { "Entity", EntityFrom },
+                        { "File", FileFrom },
+                        { "MultiLanguageProperty", MultiLanguagePropertyFrom },
+                        { "Operation", OperationFrom },
+                        { "Property", PropertyFrom },
+                        { "Range", RangeFrom },
+                        { "ReferenceElement", ReferenceElementFrom },
+                        { "Submodel", SubmodelFrom },
+                        { "SubmodelElementCollection", SubmodelElementCollectionFrom },
+                        { "SubmodelElementList", SubmodelElementListFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of IHasDataSpecification by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -984,67 +938,15 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
-                {
-                    case "AdministrativeInformation":
-                        return AdministrativeInformationFrom(
-                            node, out error);
-                    case "RelationshipElement":
-                        return RelationshipElementFrom(
-                            node, out error);
-                    case "AnnotatedRelationshipElement":
-                        return AnnotatedRelationshipElementFrom(
-                            node, out error);
-                    case "AssetAdministrationShell":
-                        return AssetAdministrationShellFrom(
-                            node, out error);
-                    case "BasicEventElement":
-                        return BasicEventElementFrom(
-                            node, out error);
-                    case "Blob":
-                        return BlobFrom(
-                            node, out error);
-                    case "Capability":
-                        return CapabilityFrom(
-                            node, out error);
-                    case "ConceptDescription":
-                        return ConceptDescriptionFrom(
-                            node, out error);
-                    case "Entity":
-                        return EntityFrom(
-                            node, out error);
-                    case "File":
-                        return FileFrom(
-                            node, out error);
-                    case "MultiLanguageProperty":
-                        return MultiLanguagePropertyFrom(
-                            node, out error);
-                    case "Operation":
-                        return OperationFrom(
-                            node, out error);
-                    case "Property":
-                        return PropertyFrom(
-                            node, out error);
-                    case "Range":
-                        return RangeFrom(
-                            node, out error);
-                    case "ReferenceElement":
-                        return ReferenceElementFrom(
-                            node, out error);
-                    case "Submodel":
-                        return SubmodelFrom(
-                            node, out error);
-                    case "SubmodelElementCollection":
-                        return SubmodelElementCollectionFrom(
-                            node, out error);
-                    case "SubmodelElementList":
-                        return SubmodelElementListFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for IHasDataSpecification: {modelType}");
-                        return null;
+                if (!_hasDataSpecificationFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.IHasDataSpecification>? fromMethod))
+                {
+                    error = new Reporting.Error(
+                        $"Unexpected model type for IHasDataSpecification: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.IHasDataSpecification IHasDataSpecificationFrom
 
             /// <summary>
@@ -1192,6 +1094,30 @@ namespace AasCore.Aas3_0_RC02
                     theRevision);
             }  // internal static AdministrativeInformationFrom
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for IQualifiable.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.IQualifiable>>
+                _qualifiableFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.IQualifiable>>()
+                    {
+                        { "RelationshipElement", RelationshipElementFrom },
+                        { "AnnotatedRelationshipElement", AnnotatedRelationshipElementFrom },
+                        { "BasicEventElement", BasicEventElementFrom },
+                        { "Blob", BlobFrom },
+                        { "Capability", CapabilityFrom },
+                        { "Entity", EntityFrom },
+                        { "File", FileFrom },
+                        { "MultiLanguageProperty", MultiLanguagePropertyFrom },
+                        { "Operation", OperationFrom },
+                        { "Property", PropertyFrom },
+                        { "Range", RangeFrom },
+                        { "ReferenceElement", ReferenceElementFrom },
+                        { "Submodel", SubmodelFrom },
+                        { "SubmodelElementCollection", SubmodelElementCollectionFrom },
+                        { "SubmodelElementList", SubmodelElementListFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of IQualifiable by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -1237,58 +1163,15 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
-                {
-                    case "RelationshipElement":
-                        return RelationshipElementFrom(
-                            node, out error);
-                    case "AnnotatedRelationshipElement":
-                        return AnnotatedRelationshipElementFrom(
-                            node, out error);
-                    case "BasicEventElement":
-                        return BasicEventElementFrom(
-                            node, out error);
-                    case "Blob":
-                        return BlobFrom(
-                            node, out error);
-                    case "Capability":
-                        return CapabilityFrom(
-                            node, out error);
-                    case "Entity":
-                        return EntityFrom(
-                            node, out error);
-                    case "File":
-                        return FileFrom(
-                            node, out error);
-                    case "MultiLanguageProperty":
-                        return MultiLanguagePropertyFrom(
-                            node, out error);
-                    case "Operation":
-                        return OperationFrom(
-                            node, out error);
-                    case "Property":
-                        return PropertyFrom(
-                            node, out error);
-                    case "Range":
-                        return RangeFrom(
-                            node, out error);
-                    case "ReferenceElement":
-                        return ReferenceElementFrom(
-                            node, out error);
-                    case "Submodel":
-                        return SubmodelFrom(
-                            node, out error);
-                    case "SubmodelElementCollection":
-                        return SubmodelElementCollectionFrom(
-                            node, out error);
-                    case "SubmodelElementList":
-                        return SubmodelElementListFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for IQualifiable: {modelType}");
-                        return null;
+                if (!_qualifiableFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.IQualifiable>? fromMethod))
+                {
+                    error = new Reporting.Error(
+                        $"Unexpected model type for IQualifiable: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.IQualifiable IQualifiableFrom
 
             /// <summary>
@@ -3134,6 +3017,29 @@ namespace AasCore.Aas3_0_RC02
                     theSubmodelElements);
             }  // internal static SubmodelFrom
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for ISubmodelElement.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.ISubmodelElement>>
+                _submodelElementFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.ISubmodelElement>>()
+                    {
+                        { "RelationshipElement", RelationshipElementFrom },
+                        { "AnnotatedRelationshipElement", AnnotatedRelationshipElementFrom },
+                        { "BasicEventElement", BasicEventElementFrom },
+                        { "Blob", BlobFrom },
+                        { "Capability", CapabilityFrom },
+                        { "Entity", EntityFrom },
+                        { "File", FileFrom },
+                        { "MultiLanguageProperty", MultiLanguagePropertyFrom },
+                        { "Operation", OperationFrom },
+                        { "Property", PropertyFrom },
+                        { "Range", RangeFrom },
+                        { "ReferenceElement", ReferenceElementFrom },
+                        { "SubmodelElementCollection", SubmodelElementCollectionFrom },
+                        { "SubmodelElementList", SubmodelElementListFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of ISubmodelElement by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -3179,57 +3085,28 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
-                {
-                    case "RelationshipElement":
-                        return RelationshipElementFrom(
-                            node, out error);
-                    case "AnnotatedRelationshipElement":
-                        return AnnotatedRelationshipElementFrom(
-                            node, out error);
-                    case "BasicEventElement":
-                        return BasicEventElementFrom(
-                            node, out error);
-                    case "Blob":
-                        return BlobFrom(
-                            node, out error);
-                    case "Capability":
-                        return CapabilityFrom(
-                            node, out error);
-                    case "Entity":
-                        return EntityFrom(
-                            node, out error);
-                    case "File":
-                        return FileFrom(
-                            node, out error);
-                    case "MultiLanguageProperty":
-                        return MultiLanguagePropertyFrom(
-                            node, out error);
-                    case "Operation":
-                        return OperationFrom(
-                            node, out error);
-                    case "Property":
-                        return PropertyFrom(
-                            node, out error);
-                    case "Range":
-                        return RangeFrom(
-                            node, out error);
-                    case "ReferenceElement":
-                        return ReferenceElementFrom(
-                            node, out error);
-                    case "SubmodelElementCollection":
-                        return SubmodelElementCollectionFrom(
-                            node, out error);
-                    case "SubmodelElementList":
-                        return SubmodelElementListFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for ISubmodelElement: {modelType}");
-                        return null;
+                if (!_submodelElementFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.ISubmodelElement>? fromMethod))
+                {
+                    error = new Reporting.Error(
+                        $"Unexpected model type for ISubmodelElement: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.ISubmodelElement ISubmodelElementFrom
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for IRelationshipElement.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.IRelationshipElement>>
+                _relationshipElementFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.IRelationshipElement>>()
+                    {
+                        { "AnnotatedRelationshipElement", AnnotatedRelationshipElementFrom },
+                        { "RelationshipElement", RelationshipElementFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of IRelationshipElement by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -3275,19 +3152,15 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
+                if (!_relationshipElementFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.IRelationshipElement>? fromMethod))
                 {
-                    case "AnnotatedRelationshipElement":
-                        return AnnotatedRelationshipElementFrom(
-                            node, out error);
-                    case "RelationshipElement":
-                        return RelationshipElementFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for IRelationshipElement: {modelType}");
-                        return null;
+                    error = new Reporting.Error(
+                        $"Unexpected model type for IRelationshipElement: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.IRelationshipElement IRelationshipElementFrom
 
             /// <summary>
@@ -4957,6 +4830,21 @@ namespace AasCore.Aas3_0_RC02
                     theValue);
             }  // internal static SubmodelElementCollectionFrom
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for IDataElement.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.IDataElement>>
+                _dataElementFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.IDataElement>>()
+                    {
+                        { "Blob", BlobFrom },
+                        { "File", FileFrom },
+                        { "MultiLanguageProperty", MultiLanguagePropertyFrom },
+                        { "Property", PropertyFrom },
+                        { "Range", RangeFrom },
+                        { "ReferenceElement", ReferenceElementFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of IDataElement by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -5002,31 +4890,15 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
-                {
-                    case "Blob":
-                        return BlobFrom(
-                            node, out error);
-                    case "File":
-                        return FileFrom(
-                            node, out error);
-                    case "MultiLanguageProperty":
-                        return MultiLanguagePropertyFrom(
-                            node, out error);
-                    case "Property":
-                        return PropertyFrom(
-                            node, out error);
-                    case "Range":
-                        return RangeFrom(
-                            node, out error);
-                    case "ReferenceElement":
-                        return ReferenceElementFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for IDataElement: {modelType}");
-                        return null;
+                if (!_dataElementFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.IDataElement>? fromMethod))
+                {
+                    error = new Reporting.Error(
+                        $"Unexpected model type for IDataElement: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.IDataElement IDataElementFrom
 
             /// <summary>
@@ -9605,6 +9477,16 @@ namespace AasCore.Aas3_0_RC02
                     thePayload);
             }  // internal static EventPayloadFrom
 
+            /// <summary>
+            /// Map the JSON model type to the deserialization function for IEventElement.
+            /// </summary>
+            private static readonly Dictionary<string, DeserializeDelegate<Aas.IEventElement>>
+                _eventElementFromByModelType = (
+                    new Dictionary<string, DeserializeDelegate<Aas.IEventElement>>()
+                    {
+                        { "BasicEventElement", BasicEventElementFrom },
+                    });
+
             /// <summary>
             /// Deserialize an instance of IEventElement by dispatching
             /// based on <c>modelType</c> property of the <paramref name="node" />.
@@ -9650,16 +9532,15 @@ namespace AasCore.Aas3_0_RC02
                     return null;
                 }
 
-                switch (modelType)
+                if (!_eventElementFromByModelType.TryGetValue(
+                        modelType,
+                        out DeserializeDelegate<Aas.IEventElement>? fromMethod))
                 {
-                    case "BasicEventElement":
-                        return BasicEventElementFrom(
-                            node, out error);
-                    default:
-                        error = new Reporting.Error(
-                            $"Unexpected model type for IEventElement: {modelType}");
-                        return null;
+                    error = new Reporting.Error(
+                        $"Unexpected model type for IEventElement: {modelType}");
+                    return null;
                 }
+                return fromMethod(node, out error);
             }  // public static Aas.IEventElement IEventElementFrom
 
             /// <summary>
@@ -12852,6 +12733,35 @@ namespace AasCore.Aas3_0_RC02
             }
         }
 
+        /// <summary>
+        /// Deserialize instances of meta-model classes from JSON nodes.
+        /// </summary>
+        /// <example>
+        /// Here is an example how to parse an instance of IHasSemantics:
+        /// <code>
+        /// string someString = "... some JSON ...";
+        /// var node = System.Text.Json.Nodes.JsonNode.Parse(someString);
+        /// Aas.IHasSemantics anInstance = Deserialize.IHasSemanticsFrom(
+        ///     node);
+        /// </code>
+        /// </example>
+        }  // public static class DeserializeImplementation
+
+        /// <summary>
+        /// Represent a critical error during the deserialization.
+        /// </summary>
+        public class Exception : System.Exception
+        {
+            public readonly string Path;
+            public readonly string Cause;
+            public Exception(string path, string cause)
+                : base($"{cause} at: {path}")
+            {
+                Path = path;
+                Cause = cause;
+            }
+        }
+
         /// <summary>
         /// Deserialize instances of meta-model classes from JSON nodes.
         /// </summary>
@@ -12892,6 +12802,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of IHasSemantics from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to IHasSemantics.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of IHasSemantics.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.IHasSemantics IHasSemanticsFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return IHasSemanticsFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Extension from <paramref name="node" />.
             /// </summary>
@@ -12917,6 +12854,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Extension from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Extension.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Extension.
+            /// </exception>
+            public static Aas.Extension ExtensionFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return ExtensionFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of IHasExtensions from <paramref name="node" />.
             /// </summary>
@@ -12943,6 +12906,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of IHasExtensions from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to IHasExtensions.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of IHasExtensions.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.IHasExtensions IHasExtensionsFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return IHasExtensionsFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of IReferable from <paramref name="node" />.
             /// </summary>
@@ -12969,6 +12959,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of IReferable from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to IReferable.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of IReferable.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.IReferable IReferableFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return IReferableFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of IIdentifiable from <paramref name="node" />.
             /// </summary>
@@ -12995,6 +13012,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of IIdentifiable from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to IIdentifiable.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of IIdentifiable.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.IIdentifiable IIdentifiableFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return IIdentifiableFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of ModelingKind from <paramref name="node" />.
             /// </summary>
@@ -13020,6 +13064,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of ModelingKind from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to ModelingKind.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of ModelingKind.
+            /// </exception>
+            public static Aas.ModelingKind ModelingKindFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return ModelingKindFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of IHasKind from <paramref name="node" />.
             /// </summary>
@@ -13046,6 +13116,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of IHasKind from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to IHasKind.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of IHasKind.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.IHasKind IHasKindFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return IHasKindFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of IHasDataSpecification from <paramref name="node" />.
             /// </summary>
@@ -13072,6 +13169,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of IHasDataSpecification from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to IHasDataSpecification.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of IHasDataSpecification.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.IHasDataSpecification IHasDataSpecificationFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return IHasDataSpecificationFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of AdministrativeInformation from <paramref name="node" />.
             /// </summary>
@@ -13097,6 +13221,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of AdministrativeInformation from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to AdministrativeInformation.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of AdministrativeInformation.
+            /// </exception>
+            public static Aas.AdministrativeInformation AdministrativeInformationFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return AdministrativeInformationFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of IQualifiable from <paramref name="node" />.
             /// </summary>
@@ -13123,6 +13273,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of IQualifiable from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to IQualifiable.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of IQualifiable.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.IQualifiable IQualifiableFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return IQualifiableFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of QualifierKind from <paramref name="node" />.
             /// </summary>
@@ -13148,6 +13325,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of QualifierKind from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to QualifierKind.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of QualifierKind.
+            /// </exception>
+            public static Aas.QualifierKind QualifierKindFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return QualifierKindFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Qualifier from <paramref name="node" />.
             /// </summary>
@@ -13174,15 +13377,41 @@ namespace AasCore.Aas3_0_RC02
             }
 
             /// <summary>
-            /// Deserialize an instance of AssetAdministrationShell from <paramref name="node" />.
+            /// Deserialize an instance of Qualifier from <paramref name="reader" />.
             /// </summary>
-            /// <param name="node">JSON node to be parsed</param>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Qualifier.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
             /// <exception cref="Jsonization.Exception">
-            /// Thrown when <paramref name="node" /> is not a valid JSON
-            /// representation of AssetAdministrationShell.
+            /// Thrown when the input is not a valid JSON
+            /// representation of Qualifier.
             /// </exception>
-            public static Aas.AssetAdministrationShell AssetAdministrationShellFrom(
-                Nodes.JsonNode node)
+            public static Aas.Qualifier QualifierFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return QualifierFrom(node);
+            }
+
+            /// <summary>
+            /// Deserialize an instance of AssetAdministrationShell from <paramref name="node" />.
+            /// </summary>
+            /// <param name="node">JSON node to be parsed</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when <paramref name="node" /> is not a valid JSON
+            /// representation of AssetAdministrationShell.
+            /// </exception>
+            public static Aas.AssetAdministrationShell AssetAdministrationShellFrom(
+                Nodes.JsonNode node)
             {
                 Aas.AssetAdministrationShell? result = DeserializeImplementation.AssetAdministrationShellFrom(
                     node,
@@ -13198,6 +13427,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of AssetAdministrationShell from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to AssetAdministrationShell.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of AssetAdministrationShell.
+            /// </exception>
+            public static Aas.AssetAdministrationShell AssetAdministrationShellFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return AssetAdministrationShellFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of AssetInformation from <paramref name="node" />.
             /// </summary>
@@ -13223,6 +13478,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of AssetInformation from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to AssetInformation.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of AssetInformation.
+            /// </exception>
+            public static Aas.AssetInformation AssetInformationFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return AssetInformationFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Resource from <paramref name="node" />.
             /// </summary>
@@ -13248,6 +13529,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Resource from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Resource.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Resource.
+            /// </exception>
+            public static Aas.Resource ResourceFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return ResourceFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of AssetKind from <paramref name="node" />.
             /// </summary>
@@ -13273,6 +13580,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of AssetKind from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to AssetKind.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of AssetKind.
+            /// </exception>
+            public static Aas.AssetKind AssetKindFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return AssetKindFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of SpecificAssetId from <paramref name="node" />.
             /// </summary>
@@ -13298,6 +13631,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of SpecificAssetId from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to SpecificAssetId.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of SpecificAssetId.
+            /// </exception>
+            public static Aas.SpecificAssetId SpecificAssetIdFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return SpecificAssetIdFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Submodel from <paramref name="node" />.
             /// </summary>
@@ -13323,6 +13682,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Submodel from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Submodel.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Submodel.
+            /// </exception>
+            public static Aas.Submodel SubmodelFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return SubmodelFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of ISubmodelElement from <paramref name="node" />.
             /// </summary>
@@ -13349,6 +13734,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of ISubmodelElement from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to ISubmodelElement.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of ISubmodelElement.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.ISubmodelElement ISubmodelElementFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return ISubmodelElementFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of IRelationshipElement from <paramref name="node" />.
             /// </summary>
@@ -13375,6 +13787,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of IRelationshipElement from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to IRelationshipElement.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of IRelationshipElement.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.IRelationshipElement IRelationshipElementFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return IRelationshipElementFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of RelationshipElement from <paramref name="node" />.
             /// </summary>
@@ -13400,6 +13839,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of RelationshipElement from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to RelationshipElement.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of RelationshipElement.
+            /// </exception>
+            public static Aas.RelationshipElement RelationshipElementFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return RelationshipElementFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of AasSubmodelElements from <paramref name="node" />.
             /// </summary>
@@ -13425,6 +13890,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of AasSubmodelElements from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to AasSubmodelElements.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of AasSubmodelElements.
+            /// </exception>
+            public static Aas.AasSubmodelElements AasSubmodelElementsFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return AasSubmodelElementsFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of SubmodelElementList from <paramref name="node" />.
             /// </summary>
@@ -13450,6 +13941,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of SubmodelElementList from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to SubmodelElementList.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of SubmodelElementList.
+            /// </exception>
+            public static Aas.SubmodelElementList SubmodelElementListFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return SubmodelElementListFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of SubmodelElementCollection from <paramref name="node" />.
             /// </summary>
@@ -13475,6 +13992,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of SubmodelElementCollection from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to SubmodelElementCollection.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of SubmodelElementCollection.
+            /// </exception>
+            public static Aas.SubmodelElementCollection SubmodelElementCollectionFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return SubmodelElementCollectionFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of IDataElement from <paramref name="node" />.
             /// </summary>
@@ -13501,6 +14044,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of IDataElement from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to IDataElement.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of IDataElement.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.IDataElement IDataElementFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return IDataElementFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Property from <paramref name="node" />.
             /// </summary>
@@ -13526,6 +14096,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Property from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Property.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Property.
+            /// </exception>
+            public static Aas.Property PropertyFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return PropertyFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of MultiLanguageProperty from <paramref name="node" />.
             /// </summary>
@@ -13551,6 +14147,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of MultiLanguageProperty from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to MultiLanguageProperty.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of MultiLanguageProperty.
+            /// </exception>
+            public static Aas.MultiLanguageProperty MultiLanguagePropertyFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return MultiLanguagePropertyFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Range from <paramref name="node" />.
             /// </summary>
@@ -13576,6 +14198,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Range from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Range.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Range.
+            /// </exception>
+            public static Aas.Range RangeFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return RangeFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of ReferenceElement from <paramref name="node" />.
             /// </summary>
@@ -13601,6 +14249,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of ReferenceElement from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to ReferenceElement.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of ReferenceElement.
+            /// </exception>
+            public static Aas.ReferenceElement ReferenceElementFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return ReferenceElementFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Blob from <paramref name="node" />.
             /// </summary>
@@ -13626,6 +14300,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Blob from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Blob.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Blob.
+            /// </exception>
+            public static Aas.Blob BlobFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return BlobFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of File from <paramref name="node" />.
             /// </summary>
@@ -13651,6 +14351,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of File from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to File.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of File.
+            /// </exception>
+            public static Aas.File FileFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return FileFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of AnnotatedRelationshipElement from <paramref name="node" />.
             /// </summary>
@@ -13676,6 +14402,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of AnnotatedRelationshipElement from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to AnnotatedRelationshipElement.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of AnnotatedRelationshipElement.
+            /// </exception>
+            public static Aas.AnnotatedRelationshipElement AnnotatedRelationshipElementFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return AnnotatedRelationshipElementFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of EntityType from <paramref name="node" />.
             /// </summary>
@@ -13701,6 +14453,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of EntityType from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to EntityType.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of EntityType.
+            /// </exception>
+            public static Aas.EntityType EntityTypeFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return EntityTypeFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Entity from <paramref name="node" />.
             /// </summary>
@@ -13726,6 +14504,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Entity from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Entity.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Entity.
+            /// </exception>
+            public static Aas.Entity EntityFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return EntityFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Direction from <paramref name="node" />.
             /// </summary>
@@ -13751,6 +14555,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Direction from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Direction.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Direction.
+            /// </exception>
+            public static Aas.Direction DirectionFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return DirectionFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of StateOfEvent from <paramref name="node" />.
             /// </summary>
@@ -13776,6 +14606,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of StateOfEvent from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to StateOfEvent.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of StateOfEvent.
+            /// </exception>
+            public static Aas.StateOfEvent StateOfEventFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return StateOfEventFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of EventPayload from <paramref name="node" />.
             /// </summary>
@@ -13801,6 +14657,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of EventPayload from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to EventPayload.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of EventPayload.
+            /// </exception>
+            public static Aas.EventPayload EventPayloadFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return EventPayloadFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of IEventElement from <paramref name="node" />.
             /// </summary>
@@ -13827,6 +14709,33 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of IEventElement from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to IEventElement.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of IEventElement.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
+            public static Aas.IEventElement IEventElementFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return IEventElementFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of BasicEventElement from <paramref name="node" />.
             /// </summary>
@@ -13852,6 +14761,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of BasicEventElement from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to BasicEventElement.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of BasicEventElement.
+            /// </exception>
+            public static Aas.BasicEventElement BasicEventElementFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return BasicEventElementFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Operation from <paramref name="node" />.
             /// </summary>
@@ -13877,6 +14812,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Operation from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Operation.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Operation.
+            /// </exception>
+            public static Aas.Operation OperationFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return OperationFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of OperationVariable from <paramref name="node" />.
             /// </summary>
@@ -13902,6 +14863,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of OperationVariable from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to OperationVariable.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of OperationVariable.
+            /// </exception>
+            public static Aas.OperationVariable OperationVariableFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return OperationVariableFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Capability from <paramref name="node" />.
             /// </summary>
@@ -13927,6 +14914,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Capability from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Capability.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Capability.
+            /// </exception>
+            public static Aas.Capability CapabilityFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return CapabilityFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of ConceptDescription from <paramref name="node" />.
             /// </summary>
@@ -13952,6 +14965,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of ConceptDescription from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to ConceptDescription.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of ConceptDescription.
+            /// </exception>
+            public static Aas.ConceptDescription ConceptDescriptionFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return ConceptDescriptionFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of ReferenceTypes from <paramref name="node" />.
             /// </summary>
@@ -13977,6 +15016,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of ReferenceTypes from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to ReferenceTypes.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of ReferenceTypes.
+            /// </exception>
+            public static Aas.ReferenceTypes ReferenceTypesFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return ReferenceTypesFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Reference from <paramref name="node" />.
             /// </summary>
@@ -14002,6 +15067,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Reference from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Reference.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Reference.
+            /// </exception>
+            public static Aas.Reference ReferenceFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return ReferenceFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Key from <paramref name="node" />.
             /// </summary>
@@ -14027,6 +15118,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of Key from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Key.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Key.
+            /// </exception>
+            public static Aas.Key KeyFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return KeyFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of KeyTypes from <paramref name="node" />.
             /// </summary>
@@ -14052,6 +15169,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of KeyTypes from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to KeyTypes.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of KeyTypes.
+            /// </exception>
+            public static Aas.KeyTypes KeyTypesFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return KeyTypesFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of DataTypeDefXsd from <paramref name="node" />.
             /// </summary>
@@ -14077,6 +15220,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of DataTypeDefXsd from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to DataTypeDefXsd.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of DataTypeDefXsd.
+            /// </exception>
+            public static Aas.DataTypeDefXsd DataTypeDefXsdFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return DataTypeDefXsdFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of LangString from <paramref name="node" />.
             /// </summary>
@@ -14102,6 +15271,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of LangString from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to LangString.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of LangString.
+            /// </exception>
+            public static Aas.LangString LangStringFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return LangStringFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of LangStringSet from <paramref name="node" />.
             /// </summary>
@@ -14127,6 +15322,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of LangStringSet from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to LangStringSet.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of LangStringSet.
+            /// </exception>
+            public static Aas.LangStringSet LangStringSetFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return LangStringSetFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of DataSpecificationContent from <paramref name="node" />.
             /// </summary>
@@ -14152,6 +15373,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of DataSpecificationContent from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to DataSpecificationContent.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of DataSpecificationContent.
+            /// </exception>
+            public static Aas.DataSpecificationContent DataSpecificationContentFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return DataSpecificationContentFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of DataSpecification from <paramref name="node" />.
             /// </summary>
@@ -14177,6 +15424,32 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Deserialize an instance of DataSpecification from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to DataSpecification.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of DataSpecification.
+            /// </exception>
+            public static Aas.DataSpecification DataSpecificationFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return DataSpecificationFrom(node);
+            }
+
             /// <summary>
             /// Deserialize an instance of Environment from <paramref name="node" />.
             /// </summary>
@@ -14201,6 +15474,32 @@ namespace AasCore.Aas3_0_RC02
                     ?? throw new System.InvalidOperationException(
                         "Unexpected output null when error is null");
             }
+
+            /// <summary>
+            /// Deserialize an instance of Environment from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The <paramref name="reader" /> is expected to be positioned either at
+            /// the start of the input or at the JSON value corresponding to Environment.
+            /// The value is read directly from the <paramref name="reader" /> without
+            /// an intermediate string representation.
+            /// </remarks>
+            /// <param name="reader">UTF-8 JSON reader positioned at the value</param>
+            /// <exception cref="Jsonization.Exception">
+            /// Thrown when the input is not a valid JSON
+            /// representation of Environment.
+            /// </exception>
+            public static Aas.Environment EnvironmentFrom(
+                ref Json.Utf8JsonReader reader)
+            {
+                Nodes.JsonNode? node = Nodes.JsonNode.Parse(ref reader);
+                if (node == null)
+                {
+                    throw new Jsonization.Exception(
+                        "", "Expected a JSON node, but got a null");
+                }
+                return EnvironmentFrom(node);
+            }
         }  // public static class Deserialize
 
         internal class Transformer
@@ -5,6 +5,7 @@
 
 using CodeAnalysis = System.Diagnostics.CodeAnalysis;
 using Regex = System.Text.RegularExpressions.Regex;
+using RegexOptions = System.Text.RegularExpressions.RegexOptions;
 using System.Collections.Generic;  // can't alias
 using System.Linq;  // can't alias
 
@@ -38,17 +39,18 @@ namespace AasCore.Aas3_0_RC02
         {
             var pattern = "^[a-zA-Z][a-zA-Z0-9_]+$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesIdShort = _constructMatchesIdShort();
+        private static readonly System.Lazy<Regex> RegexMatchesIdShort =
+            new System.Lazy<Regex>(_constructMatchesIdShort);
 
         /// <summary>
         /// Check that <paramref name="text" /> is a valid short ID.
         /// </summary>
         public static bool MatchesIdShort(string text)
         {
-            return RegexMatchesIdShort.IsMatch(text);
+            return RegexMatchesIdShort.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -68,10 +70,11 @@ namespace AasCore.Aas3_0_RC02
             var dateTimeStampLexicalRep = $"{yearFrag}-{monthFrag}-{dayFrag}T(({hourFrag}:{minuteFrag}:{secondFrag})|{endOfDayFrag}){timezoneFrag}";
             var pattern = $"^{dateTimeStampLexicalRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsDateTimeStampUtc = _constructMatchesXsDateTimeStampUtc();
+        private static readonly System.Lazy<Regex> RegexMatchesXsDateTimeStampUtc =
+            new System.Lazy<Regex>(_constructMatchesXsDateTimeStampUtc);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:dateTimeStamp</c>.
@@ -94,7 +97,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsDateTimeStampUtc(string text)
         {
-            return RegexMatchesXsDateTimeStampUtc.IsMatch(text);
+            return RegexMatchesXsDateTimeStampUtc.Value.IsMatch(text);
         }
 
         private static readonly string[] XsDateFormats = {
@@ -189,10 +192,11 @@ namespace AasCore.Aas3_0_RC02
             var parameter = $"{token}=({token}|{quotedString})";
             var mediaType = $"^{type}/{subtype}({ows};{ows}{parameter})*$";
 
-            return new Regex(mediaType);
+            return new Regex(mediaType, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesMimeType = _constructMatchesMimeType();
+        private static readonly System.Lazy<Regex> RegexMatchesMimeType =
+            new System.Lazy<Regex>(_constructMatchesMimeType);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of MIME type.
@@ -211,7 +215,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesMimeType(string text)
         {
-            return RegexMatchesMimeType.IsMatch(text);
+            return RegexMatchesMimeType.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -243,10 +247,11 @@ namespace AasCore.Aas3_0_RC02
             var fileUri = $"{fileScheme}:{fileHierPart}";
             var pattern = $"^{fileUri}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesRfc8089Path = _constructMatchesRfc8089Path();
+        private static readonly System.Lazy<Regex> RegexMatchesRfc8089Path =
+            new System.Lazy<Regex>(_constructMatchesRfc8089Path);
 
         /// <summary>
         /// Check that <paramref name="text" /> is a path conforming to the pattern of RFC 8089.
@@ -263,7 +268,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesRfc8089Path(string text)
         {
-            return RegexMatchesRfc8089Path.IsMatch(text);
+            return RegexMatchesRfc8089Path.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -287,10 +292,11 @@ namespace AasCore.Aas3_0_RC02
             var languageTag = $"({langtag}|{privateuse}|{grandfathered})";
             var pattern = $"^{languageTag}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesBcp47 = _constructMatchesBcp47();
+        private static readonly System.Lazy<Regex> RegexMatchesBcp47 =
+            new System.Lazy<Regex>(_constructMatchesBcp47);
 
         /// <summary>
         /// Check that <paramref name="text" /> is a valid BCP 47 language tag.
@@ -300,7 +306,7 @@ namespace AasCore.Aas3_0_RC02
         /// </remarks>
         public static bool MatchesBcp47(string text)
         {
-            return RegexMatchesBcp47.IsMatch(text);
+            return RegexMatchesBcp47.Value.IsMatch(text);
         }
 
         /// <summary>
@@ -385,10 +391,11 @@ namespace AasCore.Aas3_0_RC02
             var iriReference = $"({iri}|{irelativeRef})";
             var pattern = $"^{iriReference}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsAnyUri = _constructMatchesXsAnyUri();
+        private static readonly System.Lazy<Regex> RegexMatchesXsAnyUri =
+            new System.Lazy<Regex>(_constructMatchesXsAnyUri);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:anyURI</c>.
@@ -405,7 +412,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsAnyUri(string text)
         {
-            return RegexMatchesXsAnyUri.IsMatch(text);
+            return RegexMatchesXsAnyUri.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -427,10 +434,11 @@ namespace AasCore.Aas3_0_RC02
             var base64Binary = $"({b64quad}*{b64final})?";
             var pattern = $"^{base64Binary}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsBase64Binary = _constructMatchesXsBase64Binary();
+        private static readonly System.Lazy<Regex> RegexMatchesXsBase64Binary =
+            new System.Lazy<Regex>(_constructMatchesXsBase64Binary);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:base64Binary</c>.
@@ -446,7 +454,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsBase64Binary(string text)
         {
-            return RegexMatchesXsBase64Binary.IsMatch(text);
+            return RegexMatchesXsBase64Binary.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -456,10 +464,11 @@ namespace AasCore.Aas3_0_RC02
         {
             var pattern = "^(true|false|1|0)$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsBoolean = _constructMatchesXsBoolean();
+        private static readonly System.Lazy<Regex> RegexMatchesXsBoolean =
+            new System.Lazy<Regex>(_constructMatchesXsBoolean);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:boolean</c>.
@@ -475,7 +484,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsBoolean(string text)
         {
-            return RegexMatchesXsBoolean.IsMatch(text);
+            return RegexMatchesXsBoolean.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -492,10 +501,11 @@ namespace AasCore.Aas3_0_RC02
             var dateLexicalRep = $"{yearFrag}-{monthFrag}-{dayFrag}{timezoneFrag}?";
             var pattern = $"^{dateLexicalRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsDate = _constructMatchesXsDate();
+        private static readonly System.Lazy<Regex> RegexMatchesXsDate =
+            new System.Lazy<Regex>(_constructMatchesXsDate);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:date</c>.
@@ -511,7 +521,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsDate(string text)
         {
-            return RegexMatchesXsDate.IsMatch(text);
+            return RegexMatchesXsDate.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -531,10 +541,11 @@ namespace AasCore.Aas3_0_RC02
             var dateTimeLexicalRep = $"{yearFrag}-{monthFrag}-{dayFrag}T(({hourFrag}:{minuteFrag}:{secondFrag})|{endOfDayFrag}){timezoneFrag}?";
             var pattern = $"^{dateTimeLexicalRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsDateTime = _constructMatchesXsDateTime();
+        private static readonly System.Lazy<Regex> RegexMatchesXsDateTime =
+            new System.Lazy<Regex>(_constructMatchesXsDateTime);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:dateTime</c>.
@@ -550,7 +561,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsDateTime(string text)
         {
-            return RegexMatchesXsDateTime.IsMatch(text);
+            return RegexMatchesXsDateTime.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -570,10 +581,11 @@ namespace AasCore.Aas3_0_RC02
             var dateTimeStampLexicalRep = $"{yearFrag}-{monthFrag}-{dayFrag}T(({hourFrag}:{minuteFrag}:{secondFrag})|{endOfDayFrag}){timezoneFrag}";
             var pattern = $"^{dateTimeStampLexicalRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsDateTimeStamp = _constructMatchesXsDateTimeStamp();
+        private static readonly System.Lazy<Regex> RegexMatchesXsDateTimeStamp =
+            new System.Lazy<Regex>(_constructMatchesXsDateTimeStamp);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:dateTimeStamp</c>.
@@ -589,7 +601,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsDateTimeStamp(string text)
         {
-            return RegexMatchesXsDateTimeStamp.IsMatch(text);
+            return RegexMatchesXsDateTimeStamp.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -606,10 +618,11 @@ namespace AasCore.Aas3_0_RC02
             var decimalLexicalRep = $"({decimalPtNumeral}|{noDecimalPtNumeral})";
             var pattern = $"^{decimalLexicalRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsDecimal = _constructMatchesXsDecimal();
+        private static readonly System.Lazy<Regex> RegexMatchesXsDecimal =
+            new System.Lazy<Regex>(_constructMatchesXsDecimal);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:decimal</c>.
@@ -625,7 +638,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsDecimal(string text)
         {
-            return RegexMatchesXsDecimal.IsMatch(text);
+            return RegexMatchesXsDecimal.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -636,10 +649,11 @@ namespace AasCore.Aas3_0_RC02
             var doubleRep = "(\\+|-)?([0-9]+(\\.[0-9]*)?|\\.[0-9]+)([Ee](\\+|-)?[0-9]+)?|(\\+|-)?INF|NaN";
             var pattern = $"^{doubleRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsDouble = _constructMatchesXsDouble();
+        private static readonly System.Lazy<Regex> RegexMatchesXsDouble =
+            new System.Lazy<Regex>(_constructMatchesXsDouble);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:double</c>.
@@ -655,7 +669,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsDouble(string text)
         {
-            return RegexMatchesXsDouble.IsMatch(text);
+            return RegexMatchesXsDouble.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -666,10 +680,11 @@ namespace AasCore.Aas3_0_RC02
             var durationRep = "-?P((([0-9]+Y([0-9]+M)?([0-9]+D)?|([0-9]+M)([0-9]+D)?|([0-9]+D))(T(([0-9]+H)([0-9]+M)?([0-9]+(\\.[0-9]+)?S)?|([0-9]+M)([0-9]+(\\.[0-9]+)?S)?|([0-9]+(\\.[0-9]+)?S)))?)|(T(([0-9]+H)([0-9]+M)?([0-9]+(\\.[0-9]+)?S)?|([0-9]+M)([0-9]+(\\.[0-9]+)?S)?|([0-9]+(\\.[0-9]+)?S))))";
             var pattern = $"^{durationRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsDuration = _constructMatchesXsDuration();
+        private static readonly System.Lazy<Regex> RegexMatchesXsDuration =
+            new System.Lazy<Regex>(_constructMatchesXsDuration);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:duration</c>.
@@ -685,7 +700,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsDuration(string text)
         {
-            return RegexMatchesXsDuration.IsMatch(text);
+            return RegexMatchesXsDuration.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -696,10 +711,11 @@ namespace AasCore.Aas3_0_RC02
             var floatRep = "(\\+|-)?([0-9]+(\\.[0-9]*)?|\\.[0-9]+)([Ee](\\+|-)?[0-9]+)?|(\\+|-)?INF|NaN";
             var pattern = $"^{floatRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsFloat = _constructMatchesXsFloat();
+        private static readonly System.Lazy<Regex> RegexMatchesXsFloat =
+            new System.Lazy<Regex>(_constructMatchesXsFloat);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:float</c>.
@@ -715,7 +731,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsFloat(string text)
         {
-            return RegexMatchesXsFloat.IsMatch(text);
+            return RegexMatchesXsFloat.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -726,10 +742,11 @@ namespace AasCore.Aas3_0_RC02
             var gDayLexicalRep = "---(0[1-9]|[12][0-9]|3[01])(Z|(\\+|-)((0[0-9]|1[0-3]):[0-5][0-9]|14:00))?";
             var pattern = $"^{gDayLexicalRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsGDay = _constructMatchesXsGDay();
+        private static readonly System.Lazy<Regex> RegexMatchesXsGDay =
+            new System.Lazy<Regex>(_constructMatchesXsGDay);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:gDay</c>.
@@ -745,7 +762,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsGDay(string text)
         {
-            return RegexMatchesXsGDay.IsMatch(text);
+            return RegexMatchesXsGDay.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -756,10 +773,11 @@ namespace AasCore.Aas3_0_RC02
             var gMonthLexicalRep = "--(0[1-9]|1[0-2])(Z|(\\+|-)((0[0-9]|1[0-3]):[0-5][0-9]|14:00))?";
             var pattern = $"^{gMonthLexicalRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsGMonth = _constructMatchesXsGMonth();
+        private static readonly System.Lazy<Regex> RegexMatchesXsGMonth =
+            new System.Lazy<Regex>(_constructMatchesXsGMonth);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:gMonth</c>.
@@ -775,7 +793,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsGMonth(string text)
         {
-            return RegexMatchesXsGMonth.IsMatch(text);
+            return RegexMatchesXsGMonth.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -786,10 +804,11 @@ namespace AasCore.Aas3_0_RC02
             var gMonthDayRep = "--(0[1-9]|1[0-2])-(0[1-9]|[12][0-9]|3[01])(Z|(\\+|-)((0[0-9]|1[0-3]):[0-5][0-9]|14:00))?";
             var pattern = $"^{gMonthDayRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsGMonthDay = _constructMatchesXsGMonthDay();
+        private static readonly System.Lazy<Regex> RegexMatchesXsGMonthDay =
+            new System.Lazy<Regex>(_constructMatchesXsGMonthDay);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:gMonthDay</c>.
@@ -805,7 +824,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsGMonthDay(string text)
         {
-            return RegexMatchesXsGMonthDay.IsMatch(text);
+            return RegexMatchesXsGMonthDay.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -816,10 +835,11 @@ namespace AasCore.Aas3_0_RC02
             var gYearRep = "-?([1-9][0-9]{3,}|0[0-9]{3})(Z|(\\+|-)((0[0-9]|1[0-3]):[0-5][0-9]|14:00))?";
             var pattern = $"^{gYearRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsGYear = _constructMatchesXsGYear();
+        private static readonly System.Lazy<Regex> RegexMatchesXsGYear =
+            new System.Lazy<Regex>(_constructMatchesXsGYear);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:gYear</c>.
@@ -835,7 +855,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsGYear(string text)
         {
-            return RegexMatchesXsGYear.IsMatch(text);
+            return RegexMatchesXsGYear.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -846,10 +866,11 @@ namespace AasCore.Aas3_0_RC02
             var gYearMonthRep = "-?([1-9][0-9]{3,}|0[0-9]{3})-(0[1-9]|1[0-2])(Z|(\\+|-)((0[0-9]|1[0-3]):[0-5][0-9]|14:00))?";
             var pattern = $"^{gYearMonthRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsGYearMonth = _constructMatchesXsGYearMonth();
+        private static readonly System.Lazy<Regex> RegexMatchesXsGYearMonth =
+            new System.Lazy<Regex>(_constructMatchesXsGYearMonth);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:gYearMonth</c>.
@@ -865,7 +886,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsGYearMonth(string text)
         {
-            return RegexMatchesXsGYearMonth.IsMatch(text);
+            return RegexMatchesXsGYearMonth.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -876,10 +897,11 @@ namespace AasCore.Aas3_0_RC02
             var hexBinary = "([0-9a-fA-F]{2})*";
             var pattern = $"^{hexBinary}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsHexBinary = _constructMatchesXsHexBinary();
+        private static readonly System.Lazy<Regex> RegexMatchesXsHexBinary =
+            new System.Lazy<Regex>(_constructMatchesXsHexBinary);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:hexBinary</c>.
@@ -895,7 +917,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsHexBinary(string text)
         {
-            return RegexMatchesXsHexBinary.IsMatch(text);
+            return RegexMatchesXsHexBinary.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -906,10 +928,11 @@ namespace AasCore.Aas3_0_RC02
             var timeRep = "(([01][0-9]|2[0-3]):[0-5][0-9]:[0-5][0-9](\\.[0-9]+)?|(24:00:00(\\.0+)?))(Z|(\\+|-)((0[0-9]|1[0-3]):[0-5][0-9]|14:00))?";
             var pattern = $"^{timeRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsTime = _constructMatchesXsTime();
+        private static readonly System.Lazy<Regex> RegexMatchesXsTime =
+            new System.Lazy<Regex>(_constructMatchesXsTime);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:time</c>.
@@ -925,7 +948,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsTime(string text)
         {
-            return RegexMatchesXsTime.IsMatch(text);
+            return RegexMatchesXsTime.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -936,10 +959,11 @@ namespace AasCore.Aas3_0_RC02
             var dayTimeDurationRep = "-?P((([0-9]+D)(T(([0-9]+H)([0-9]+M)?([0-9]+(\\.[0-9]+)?S)?|([0-9]+M)([0-9]+(\\.[0-9]+)?S)?|([0-9]+(\\.[0-9]+)?S)))?)|(T(([0-9]+H)([0-9]+M)?([0-9]+(\\.[0-9]+)?S)?|([0-9]+M)([0-9]+(\\.[0-9]+)?S)?|([0-9]+(\\.[0-9]+)?S))))";
             var pattern = $"^{dayTimeDurationRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsDayTimeDuration = _constructMatchesXsDayTimeDuration();
+        private static readonly System.Lazy<Regex> RegexMatchesXsDayTimeDuration =
+            new System.Lazy<Regex>(_constructMatchesXsDayTimeDuration);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:dayTimeDuration</c>.
@@ -955,7 +979,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsDayTimeDuration(string text)
         {
-            return RegexMatchesXsDayTimeDuration.IsMatch(text);
+            return RegexMatchesXsDayTimeDuration.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -966,10 +990,11 @@ namespace AasCore.Aas3_0_RC02
             var yearMonthDurationRep = "-?P((([0-9]+Y)([0-9]+M)?)|([0-9]+M))";
             var pattern = $"^{yearMonthDurationRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsYearMonthDuration = _constructMatchesXsYearMonthDuration();
+        private static readonly System.Lazy<Regex> RegexMatchesXsYearMonthDuration =
+            new System.Lazy<Regex>(_constructMatchesXsYearMonthDuration);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:yearMonthDuration</c>.
@@ -985,7 +1010,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsYearMonthDuration(string text)
         {
-            return RegexMatchesXsYearMonthDuration.IsMatch(text);
+            return RegexMatchesXsYearMonthDuration.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -996,10 +1021,11 @@ namespace AasCore.Aas3_0_RC02
             var integerRep = "[-+]?[0-9]+";
             var pattern = $"^{integerRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsInteger = _constructMatchesXsInteger();
+        private static readonly System.Lazy<Regex> RegexMatchesXsInteger =
+            new System.Lazy<Regex>(_constructMatchesXsInteger);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:integer</c>.
@@ -1015,7 +1041,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsInteger(string text)
         {
-            return RegexMatchesXsInteger.IsMatch(text);
+            return RegexMatchesXsInteger.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1026,10 +1052,11 @@ namespace AasCore.Aas3_0_RC02
             var longRep = "[-+]?0*[0-9]{1,20}";
             var pattern = $"^{longRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsLong = _constructMatchesXsLong();
+        private static readonly System.Lazy<Regex> RegexMatchesXsLong =
+            new System.Lazy<Regex>(_constructMatchesXsLong);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:long</c>.
@@ -1045,7 +1072,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsLong(string text)
         {
-            return RegexMatchesXsLong.IsMatch(text);
+            return RegexMatchesXsLong.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1056,10 +1083,11 @@ namespace AasCore.Aas3_0_RC02
             var intRep = "[-+]?0*[0-9]{1,10}";
             var pattern = $"^{intRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsInt = _constructMatchesXsInt();
+        private static readonly System.Lazy<Regex> RegexMatchesXsInt =
+            new System.Lazy<Regex>(_constructMatchesXsInt);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:int</c>.
@@ -1075,7 +1103,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsInt(string text)
         {
-            return RegexMatchesXsInt.IsMatch(text);
+            return RegexMatchesXsInt.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1086,10 +1114,11 @@ namespace AasCore.Aas3_0_RC02
             var shortRep = "[-+]?0*[0-9]{1,5}";
             var pattern = $"^{shortRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsShort = _constructMatchesXsShort();
+        private static readonly System.Lazy<Regex> RegexMatchesXsShort =
+            new System.Lazy<Regex>(_constructMatchesXsShort);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:short</c>.
@@ -1105,7 +1134,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsShort(string text)
         {
-            return RegexMatchesXsShort.IsMatch(text);
+            return RegexMatchesXsShort.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1116,10 +1145,11 @@ namespace AasCore.Aas3_0_RC02
             var byteRep = "[-+]?0*[0-9]{1,3}";
             var pattern = $"^{byteRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsByte = _constructMatchesXsByte();
+        private static readonly System.Lazy<Regex> RegexMatchesXsByte =
+            new System.Lazy<Regex>(_constructMatchesXsByte);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:byte</c>.
@@ -1135,7 +1165,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsByte(string text)
         {
-            return RegexMatchesXsByte.IsMatch(text);
+            return RegexMatchesXsByte.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1146,10 +1176,11 @@ namespace AasCore.Aas3_0_RC02
             var nonNegativeIntegerRep = "(-0|\\+?[0-9]+)";
             var pattern = $"^{nonNegativeIntegerRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsNonNegativeInteger = _constructMatchesXsNonNegativeInteger();
+        private static readonly System.Lazy<Regex> RegexMatchesXsNonNegativeInteger =
+            new System.Lazy<Regex>(_constructMatchesXsNonNegativeInteger);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:nonNegativeInteger</c>.
@@ -1165,7 +1196,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsNonNegativeInteger(string text)
         {
-            return RegexMatchesXsNonNegativeInteger.IsMatch(text);
+            return RegexMatchesXsNonNegativeInteger.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1176,10 +1207,11 @@ namespace AasCore.Aas3_0_RC02
             var positiveIntegerRep = "\\+?0*[1-9][0-9]*";
             var pattern = $"^{positiveIntegerRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsPositiveInteger = _constructMatchesXsPositiveInteger();
+        private static readonly System.Lazy<Regex> RegexMatchesXsPositiveInteger =
+            new System.Lazy<Regex>(_constructMatchesXsPositiveInteger);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:positiveInteger</c>.
@@ -1195,7 +1227,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsPositiveInteger(string text)
         {
-            return RegexMatchesXsPositiveInteger.IsMatch(text);
+            return RegexMatchesXsPositiveInteger.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1206,10 +1238,11 @@ namespace AasCore.Aas3_0_RC02
             var unsignedLongRep = "(-0|\\+?0*[0-9]{1,20})";
             var pattern = $"^{unsignedLongRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsUnsignedLong = _constructMatchesXsUnsignedLong();
+        private static readonly System.Lazy<Regex> RegexMatchesXsUnsignedLong =
+            new System.Lazy<Regex>(_constructMatchesXsUnsignedLong);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:unsignedLong</c>.
@@ -1225,7 +1258,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsUnsignedLong(string text)
         {
-            return RegexMatchesXsUnsignedLong.IsMatch(text);
+            return RegexMatchesXsUnsignedLong.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1236,10 +1269,11 @@ namespace AasCore.Aas3_0_RC02
             var unsignedIntRep = "(-0|\\+?0*[0-9]{1,10})";
             var pattern = $"^{unsignedIntRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsUnsignedInt = _constructMatchesXsUnsignedInt();
+        private static readonly System.Lazy<Regex> RegexMatchesXsUnsignedInt =
+            new System.Lazy<Regex>(_constructMatchesXsUnsignedInt);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:unsignedInt</c>.
@@ -1255,7 +1289,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsUnsignedInt(string text)
         {
-            return RegexMatchesXsUnsignedInt.IsMatch(text);
+            return RegexMatchesXsUnsignedInt.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1266,10 +1300,11 @@ namespace AasCore.Aas3_0_RC02
             var unsignedShortRep = "(-0|\\+?0*[0-9]{1,5})";
             var pattern = $"^{unsignedShortRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsUnsignedShort = _constructMatchesXsUnsignedShort();
+        private static readonly System.Lazy<Regex> RegexMatchesXsUnsignedShort =
+            new System.Lazy<Regex>(_constructMatchesXsUnsignedShort);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:unsignedShort</c>.
@@ -1285,7 +1320,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsUnsignedShort(string text)
         {
-            return RegexMatchesXsUnsignedShort.IsMatch(text);
+            return RegexMatchesXsUnsignedShort.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1296,10 +1331,11 @@ namespace AasCore.Aas3_0_RC02
             var unsignedByteRep = "(-0|\\+?0*[0-9]{1,3})";
             var pattern = $"^{unsignedByteRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsUnsignedByte = _constructMatchesXsUnsignedByte();
+        private static readonly System.Lazy<Regex> RegexMatchesXsUnsignedByte =
+            new System.Lazy<Regex>(_constructMatchesXsUnsignedByte);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:unsignedByte</c>.
@@ -1315,7 +1351,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsUnsignedByte(string text)
         {
-            return RegexMatchesXsUnsignedByte.IsMatch(text);
+            return RegexMatchesXsUnsignedByte.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1326,10 +1362,11 @@ namespace AasCore.Aas3_0_RC02
             var nonPositiveIntegerRep = "(\\+0|0|-[0-9]+)";
             var pattern = $"^{nonPositiveIntegerRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsNonPositiveInteger = _constructMatchesXsNonPositiveInteger();
+        private static readonly System.Lazy<Regex> RegexMatchesXsNonPositiveInteger =
+            new System.Lazy<Regex>(_constructMatchesXsNonPositiveInteger);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:nonPositiveInteger</c>.
@@ -1345,7 +1382,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsNonPositiveInteger(string text)
         {
-            return RegexMatchesXsNonPositiveInteger.IsMatch(text);
+            return RegexMatchesXsNonPositiveInteger.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1356,10 +1393,11 @@ namespace AasCore.Aas3_0_RC02
             var negativeIntegerRep = "(-0*[1-9][0-9]*)";
             var pattern = $"^{negativeIntegerRep}$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsNegativeInteger = _constructMatchesXsNegativeInteger();
+        private static readonly System.Lazy<Regex> RegexMatchesXsNegativeInteger =
+            new System.Lazy<Regex>(_constructMatchesXsNegativeInteger);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:negativeInteger</c>.
@@ -1375,7 +1413,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsNegativeInteger(string text)
         {
-            return RegexMatchesXsNegativeInteger.IsMatch(text);
+            return RegexMatchesXsNegativeInteger.Value.IsMatch(text);
         }
 
         [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]
@@ -1385,10 +1423,11 @@ namespace AasCore.Aas3_0_RC02
         {
             var pattern = "^([\\x01-\\ud7ff\\ue000-\\ufffd]|\\ud800[\\udc00-\\udfff]|[\\ud801-\\udbfe][\\udc00-\\udfff]|\\udbff[\\udc00-\\udfff])*$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesXsString = _constructMatchesXsString();
+        private static readonly System.Lazy<Regex> RegexMatchesXsString =
+            new System.Lazy<Regex>(_constructMatchesXsString);
 
         /// <summary>
         /// Check that <paramref name="text" /> conforms to the pattern of an <c>xs:string</c>.
@@ -1404,7 +1443,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesXsString(string text)
         {
-            return RegexMatchesXsString.IsMatch(text);
+            return RegexMatchesXsString.Value.IsMatch(text);
         }
 
         /// <summary>
@@ -1932,10 +1971,11 @@ namespace AasCore.Aas3_0_RC02
         {
             var pattern = "^[gG][lL][oO][bB][aA][lL][aA][sS][sS][eE][tT][iI][dD]$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchesGlobalAssetIdLiterally = _constructMatchesGlobalAssetIdLiterally();
+        private static readonly System.Lazy<Regex> RegexMatchesGlobalAssetIdLiterally =
+            new System.Lazy<Regex>(_constructMatchesGlobalAssetIdLiterally);
 
         /// <summary>
         /// Check that the <paramref name="text" /> matches <c>globalAssetId</c> case-insensitive.
@@ -1953,7 +1993,7 @@ namespace AasCore.Aas3_0_RC02
         /// </returns>
         public static bool MatchesGlobalAssetIdLiterally(string text)
         {
-            return RegexMatchesGlobalAssetIdLiterally.IsMatch(text);
+            return RegexMatchesGlobalAssetIdLiterally.Value.IsMatch(text);
         }
 
         /// <summary>
@@ -4,6 +4,7 @@
  */
 
 using CodeAnalysis = System.Diagnostics.CodeAnalysis;
+using Tasks = System.Threading.Tasks;
 using Xml = System.Xml;
 using System.Collections.Generic;  // can't alias
 
@@ -17350,6 +17351,49 @@ namespace AasCore.Aas3_0_RC02
         /// </example>
         public static class Deserialize
         {
+            /// <summary>
+            /// Pool the builders used to buffer the XML elements
+            /// during the asynchronous deserialization.
+            /// </summary>
+            private static readonly System.Collections.Concurrent.ConcurrentBag<System.Text.StringBuilder>
+                _builderPool = (
+                    new System.Collections.Concurrent.ConcurrentBag<System.Text.StringBuilder>());
+
+            /// <summary>
+            /// Asynchronously read the element at the cursor of
+            /// <paramref name="reader" /> into an in-memory buffer.
+            /// </summary>
+            /// <remarks>
+            /// The builders underlying the buffers are pooled so that the repeated
+            /// calls do not allocate a builder for each element anew.
+            /// </remarks>
+            private static async Tasks.Task<string> ReadElementIntoBufferAsync(
+                Xml.XmlReader reader)
+            {
+                if (!_builderPool.TryTake(out System.Text.StringBuilder? builder))
+                {
+                    builder = new System.Text.StringBuilder();
+                }
+                try
+                {
+                    var writerSettings = new Xml.XmlWriterSettings
+                    {
+                        Async = true,
+                        ConformanceLevel = Xml.ConformanceLevel.Fragment
+                    };
+                    using (var writer = Xml.XmlWriter.Create(builder, writerSettings))
+                    {
+                        await writer.WriteNodeAsync(reader, false);
+                    }
+                    return builder.ToString();
+                }
+                finally
+                {
+                    builder.Clear();
+                    _builderPool.Add(builder);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of IHasSemantics from <paramref name="reader" />.
             /// </summary>
@@ -17382,6 +17426,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of IHasSemantics
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of IHasSemantics.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.IHasSemantics> IHasSemanticsFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return IHasSemanticsFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of Extension from <paramref name="reader" />.
             /// </summary>
@@ -17414,6 +17489,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of Extension
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Extension.
+            /// </exception>
+            public static async Tasks.Task<Aas.Extension> ExtensionFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return ExtensionFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of IHasExtensions from <paramref name="reader" />.
             /// </summary>
@@ -17446,6 +17552,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of IHasExtensions
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of IHasExtensions.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.IHasExtensions> IHasExtensionsFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return IHasExtensionsFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of IReferable from <paramref name="reader" />.
             /// </summary>
@@ -17478,6 +17615,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of IReferable
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of IReferable.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.IReferable> IReferableFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return IReferableFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of IIdentifiable from <paramref name="reader" />.
             /// </summary>
@@ -17510,6 +17678,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of IIdentifiable
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of IIdentifiable.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.IIdentifiable> IIdentifiableFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return IIdentifiableFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of IHasKind from <paramref name="reader" />.
             /// </summary>
@@ -17542,6 +17741,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of IHasKind
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of IHasKind.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.IHasKind> IHasKindFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return IHasKindFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of IHasDataSpecification from <paramref name="reader" />.
             /// </summary>
@@ -17575,8 +17805,15 @@ namespace AasCore.Aas3_0_RC02
             }
 
             /// <summary>
-            /// Deserialize an instance of AdministrativeInformation from <paramref name="reader" />.
+            /// Asynchronously deserialize an instance of IHasDataSpecification
+            /// from <paramref name="reader" />.
             /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
             /// The expected namespace that the XML elements live in.
@@ -17584,30 +17821,22 @@ namespace AasCore.Aas3_0_RC02
             /// </param>
             /// <exception cref="Xmlization.Exception">
             /// Thrown when the element is not a valid XML
-            /// representation of AdministrativeInformation.
+            /// representation of IHasDataSpecification.
             /// </exception>
-            public static Aas.AdministrativeInformation AdministrativeInformationFrom(
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.IHasDataSpecification> IHasDataSpecificationFromAsync(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.AdministrativeInformation? result = (
-                    DeserializeImplementation.AdministrativeInformationFromElement(
-                        reader,
-                        ns,
-                        out Reporting.Error? error));
-                if (error != null)
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
                 {
-                    throw new Xmlization.Exception(
-                        Reporting.GenerateRelativeXPath(error.PathSegments),
-                        error.Cause);
+                    return IHasDataSpecificationFrom(bufferedReader, ns);
                 }
-                return result
-                    ?? throw new System.InvalidOperationException(
-                        "Unexpected output null when error is null");
             }
 
             /// <summary>
-            /// Deserialize an instance of IQualifiable from <paramref name="reader" />.
+            /// Deserialize an instance of AdministrativeInformation from <paramref name="reader" />.
             /// </summary>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
@@ -17616,14 +17845,14 @@ namespace AasCore.Aas3_0_RC02
             /// </param>
             /// <exception cref="Xmlization.Exception">
             /// Thrown when the element is not a valid XML
-            /// representation of IQualifiable.
+            /// representation of AdministrativeInformation.
             /// </exception>
-            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static Aas.IQualifiable IQualifiableFrom(
+            public static Aas.AdministrativeInformation AdministrativeInformationFrom(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.IQualifiable? result = (
-                    DeserializeImplementation.IQualifiableFromElement(
+                Aas.AdministrativeInformation? result = (
+                    DeserializeImplementation.AdministrativeInformationFromElement(
                         reader,
                         ns,
                         out Reporting.Error? error));
@@ -17639,8 +17868,15 @@ namespace AasCore.Aas3_0_RC02
             }
 
             /// <summary>
-            /// Deserialize an instance of Qualifier from <paramref name="reader" />.
+            /// Asynchronously deserialize an instance of AdministrativeInformation
+            /// from <paramref name="reader" />.
             /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
             /// The expected namespace that the XML elements live in.
@@ -17648,30 +17884,22 @@ namespace AasCore.Aas3_0_RC02
             /// </param>
             /// <exception cref="Xmlization.Exception">
             /// Thrown when the element is not a valid XML
-            /// representation of Qualifier.
+            /// representation of AdministrativeInformation.
             /// </exception>
-            public static Aas.Qualifier QualifierFrom(
+            public static async Tasks.Task<Aas.AdministrativeInformation> AdministrativeInformationFromAsync(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.Qualifier? result = (
-                    DeserializeImplementation.QualifierFromElement(
-                        reader,
-                        ns,
-                        out Reporting.Error? error));
-                if (error != null)
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
                 {
-                    throw new Xmlization.Exception(
-                        Reporting.GenerateRelativeXPath(error.PathSegments),
-                        error.Cause);
+                    return AdministrativeInformationFrom(bufferedReader, ns);
                 }
-                return result
-                    ?? throw new System.InvalidOperationException(
-                        "Unexpected output null when error is null");
             }
 
             /// <summary>
-            /// Deserialize an instance of AssetAdministrationShell from <paramref name="reader" />.
+            /// Deserialize an instance of IQualifiable from <paramref name="reader" />.
             /// </summary>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
@@ -17680,14 +17908,14 @@ namespace AasCore.Aas3_0_RC02
             /// </param>
             /// <exception cref="Xmlization.Exception">
             /// Thrown when the element is not a valid XML
-            /// representation of AssetAdministrationShell.
+            /// representation of IQualifiable.
             /// </exception>
-            public static Aas.AssetAdministrationShell AssetAdministrationShellFrom(
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static Aas.IQualifiable IQualifiableFrom(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.AssetAdministrationShell? result = (
-                    DeserializeImplementation.AssetAdministrationShellFromElement(
+                Aas.IQualifiable? result = (
+                    DeserializeImplementation.IQualifiableFromElement(
                         reader,
                         ns,
                         out Reporting.Error? error));
@@ -17703,8 +17931,15 @@ namespace AasCore.Aas3_0_RC02
             }
 
             /// <summary>
-            /// Deserialize an instance of AssetInformation from <paramref name="reader" />.
+            /// Asynchronously deserialize an instance of IQualifiable
+            /// from <paramref name="reader" />.
             /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
             /// The expected namespace that the XML elements live in.
@@ -17712,30 +17947,22 @@ namespace AasCore.Aas3_0_RC02
             /// </param>
             /// <exception cref="Xmlization.Exception">
             /// Thrown when the element is not a valid XML
-            /// representation of AssetInformation.
+            /// representation of IQualifiable.
             /// </exception>
-            public static Aas.AssetInformation AssetInformationFrom(
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.IQualifiable> IQualifiableFromAsync(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.AssetInformation? result = (
-                    DeserializeImplementation.AssetInformationFromElement(
-                        reader,
-                        ns,
-                        out Reporting.Error? error));
-                if (error != null)
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
                 {
-                    throw new Xmlization.Exception(
-                        Reporting.GenerateRelativeXPath(error.PathSegments),
-                        error.Cause);
+                    return IQualifiableFrom(bufferedReader, ns);
                 }
-                return result
-                    ?? throw new System.InvalidOperationException(
-                        "Unexpected output null when error is null");
             }
 
             /// <summary>
-            /// Deserialize an instance of Resource from <paramref name="reader" />.
+            /// Deserialize an instance of Qualifier from <paramref name="reader" />.
             /// </summary>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
@@ -17744,14 +17971,14 @@ namespace AasCore.Aas3_0_RC02
             /// </param>
             /// <exception cref="Xmlization.Exception">
             /// Thrown when the element is not a valid XML
-            /// representation of Resource.
+            /// representation of Qualifier.
             /// </exception>
-            public static Aas.Resource ResourceFrom(
+            public static Aas.Qualifier QualifierFrom(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.Resource? result = (
-                    DeserializeImplementation.ResourceFromElement(
+                Aas.Qualifier? result = (
+                    DeserializeImplementation.QualifierFromElement(
                         reader,
                         ns,
                         out Reporting.Error? error));
@@ -17767,8 +17994,15 @@ namespace AasCore.Aas3_0_RC02
             }
 
             /// <summary>
-            /// Deserialize an instance of SpecificAssetId from <paramref name="reader" />.
+            /// Asynchronously deserialize an instance of Qualifier
+            /// from <paramref name="reader" />.
             /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
             /// The expected namespace that the XML elements live in.
@@ -17776,30 +18010,22 @@ namespace AasCore.Aas3_0_RC02
             /// </param>
             /// <exception cref="Xmlization.Exception">
             /// Thrown when the element is not a valid XML
-            /// representation of SpecificAssetId.
+            /// representation of Qualifier.
             /// </exception>
-            public static Aas.SpecificAssetId SpecificAssetIdFrom(
+            public static async Tasks.Task<Aas.Qualifier> QualifierFromAsync(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.SpecificAssetId? result = (
-                    DeserializeImplementation.SpecificAssetIdFromElement(
-                        reader,
-                        ns,
-                        out Reporting.Error? error));
-                if (error != null)
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
                 {
-                    throw new Xmlization.Exception(
-                        Reporting.GenerateRelativeXPath(error.PathSegments),
-                        error.Cause);
+                    return QualifierFrom(bufferedReader, ns);
                 }
-                return result
-                    ?? throw new System.InvalidOperationException(
-                        "Unexpected output null when error is null");
             }
 
             /// <summary>
-            /// Deserialize an instance of Submodel from <paramref name="reader" />.
+            /// Deserialize an instance of AssetAdministrationShell from <paramref name="reader" />.
             /// </summary>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
@@ -17808,14 +18034,14 @@ namespace AasCore.Aas3_0_RC02
             /// </param>
             /// <exception cref="Xmlization.Exception">
             /// Thrown when the element is not a valid XML
-            /// representation of Submodel.
+            /// representation of AssetAdministrationShell.
             /// </exception>
-            public static Aas.Submodel SubmodelFrom(
+            public static Aas.AssetAdministrationShell AssetAdministrationShellFrom(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.Submodel? result = (
-                    DeserializeImplementation.SubmodelFromElement(
+                Aas.AssetAdministrationShell? result = (
+                    DeserializeImplementation.AssetAdministrationShellFromElement(
                         reader,
                         ns,
                         out Reporting.Error? error));
@@ -17831,8 +18057,15 @@ namespace AasCore.Aas3_0_RC02
             }
 
             /// <summary>
-            /// Deserialize an instance of ISubmodelElement from <paramref name="reader" />.
+            /// Asynchronously deserialize an instance of AssetAdministrationShell
+            /// from <paramref name="reader" />.
             /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
             /// The expected namespace that the XML elements live in.
@@ -17840,7 +18073,283 @@ namespace AasCore.Aas3_0_RC02
             /// </param>
             /// <exception cref="Xmlization.Exception">
             /// Thrown when the element is not a valid XML
-            /// representation of ISubmodelElement.
+            /// representation of AssetAdministrationShell.
+            /// </exception>
+            public static async Tasks.Task<Aas.AssetAdministrationShell> AssetAdministrationShellFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return AssetAdministrationShellFrom(bufferedReader, ns);
+                }
+            }
+
+            /// <summary>
+            /// Deserialize an instance of AssetInformation from <paramref name="reader" />.
+            /// </summary>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of AssetInformation.
+            /// </exception>
+            public static Aas.AssetInformation AssetInformationFrom(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                Aas.AssetInformation? result = (
+                    DeserializeImplementation.AssetInformationFromElement(
+                        reader,
+                        ns,
+                        out Reporting.Error? error));
+                if (error != null)
+                {
+                    throw new Xmlization.Exception(
+                        Reporting.GenerateRelativeXPath(error.PathSegments),
+                        error.Cause);
+                }
+                return result
+                    ?? throw new System.InvalidOperationException(
+                        "Unexpected output null when error is null");
+            }
+
+            /// <summary>
+            /// Asynchronously deserialize an instance of AssetInformation
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of AssetInformation.
+            /// </exception>
+            public static async Tasks.Task<Aas.AssetInformation> AssetInformationFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return AssetInformationFrom(bufferedReader, ns);
+                }
+            }
+
+            /// <summary>
+            /// Deserialize an instance of Resource from <paramref name="reader" />.
+            /// </summary>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Resource.
+            /// </exception>
+            public static Aas.Resource ResourceFrom(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                Aas.Resource? result = (
+                    DeserializeImplementation.ResourceFromElement(
+                        reader,
+                        ns,
+                        out Reporting.Error? error));
+                if (error != null)
+                {
+                    throw new Xmlization.Exception(
+                        Reporting.GenerateRelativeXPath(error.PathSegments),
+                        error.Cause);
+                }
+                return result
+                    ?? throw new System.InvalidOperationException(
+                        "Unexpected output null when error is null");
+            }
+
+            /// <summary>
+            /// Asynchronously deserialize an instance of Resource
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Resource.
+            /// </exception>
+            public static async Tasks.Task<Aas.Resource> ResourceFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return ResourceFrom(bufferedReader, ns);
+                }
+            }
+
+            /// <summary>
+            /// Deserialize an instance of SpecificAssetId from <paramref name="reader" />.
+            /// </summary>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of SpecificAssetId.
+            /// </exception>
+            public static Aas.SpecificAssetId SpecificAssetIdFrom(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                Aas.SpecificAssetId? result = (
+                    DeserializeImplementation.SpecificAssetIdFromElement(
+                        reader,
+                        ns,
+                        out Reporting.Error? error));
+                if (error != null)
+                {
+                    throw new Xmlization.Exception(
+                        Reporting.GenerateRelativeXPath(error.PathSegments),
+                        error.Cause);
+                }
+                return result
+                    ?? throw new System.InvalidOperationException(
+                        "Unexpected output null when error is null");
+            }
+
+            /// <summary>
+            /// Asynchronously deserialize an instance of SpecificAssetId
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of SpecificAssetId.
+            /// </exception>
+            public static async Tasks.Task<Aas.SpecificAssetId> SpecificAssetIdFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return SpecificAssetIdFrom(bufferedReader, ns);
+                }
+            }
+
+            /// <summary>
+            /// Deserialize an instance of Submodel from <paramref name="reader" />.
+            /// </summary>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Submodel.
+            /// </exception>
+            public static Aas.Submodel SubmodelFrom(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                Aas.Submodel? result = (
+                    DeserializeImplementation.SubmodelFromElement(
+                        reader,
+                        ns,
+                        out Reporting.Error? error));
+                if (error != null)
+                {
+                    throw new Xmlization.Exception(
+                        Reporting.GenerateRelativeXPath(error.PathSegments),
+                        error.Cause);
+                }
+                return result
+                    ?? throw new System.InvalidOperationException(
+                        "Unexpected output null when error is null");
+            }
+
+            /// <summary>
+            /// Asynchronously deserialize an instance of Submodel
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Submodel.
+            /// </exception>
+            public static async Tasks.Task<Aas.Submodel> SubmodelFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return SubmodelFrom(bufferedReader, ns);
+                }
+            }
+
+            /// <summary>
+            /// Deserialize an instance of ISubmodelElement from <paramref name="reader" />.
+            /// </summary>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of ISubmodelElement.
             /// </exception>
             [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static Aas.ISubmodelElement ISubmodelElementFrom(
                 Xml.XmlReader reader,
@@ -17862,6 +18371,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of ISubmodelElement
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of ISubmodelElement.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.ISubmodelElement> ISubmodelElementFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return ISubmodelElementFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of IRelationshipElement from <paramref name="reader" />.
             /// </summary>
@@ -17894,6 +18434,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of IRelationshipElement
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of IRelationshipElement.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.IRelationshipElement> IRelationshipElementFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return IRelationshipElementFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of RelationshipElement from <paramref name="reader" />.
             /// </summary>
@@ -17926,6 +18497,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of RelationshipElement
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of RelationshipElement.
+            /// </exception>
+            public static async Tasks.Task<Aas.RelationshipElement> RelationshipElementFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return RelationshipElementFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of SubmodelElementList from <paramref name="reader" />.
             /// </summary>
@@ -17936,14 +18538,77 @@ namespace AasCore.Aas3_0_RC02
             /// </param>
             /// <exception cref="Xmlization.Exception">
             /// Thrown when the element is not a valid XML
-            /// representation of SubmodelElementList.
+            /// representation of SubmodelElementList.
+            /// </exception>
+            public static Aas.SubmodelElementList SubmodelElementListFrom(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                Aas.SubmodelElementList? result = (
+                    DeserializeImplementation.SubmodelElementListFromElement(
+                        reader,
+                        ns,
+                        out Reporting.Error? error));
+                if (error != null)
+                {
+                    throw new Xmlization.Exception(
+                        Reporting.GenerateRelativeXPath(error.PathSegments),
+                        error.Cause);
+                }
+                return result
+                    ?? throw new System.InvalidOperationException(
+                        "Unexpected output null when error is null");
+            }
+
+            /// <summary>
+            /// Asynchronously deserialize an instance of SubmodelElementList
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of SubmodelElementList.
+            /// </exception>
+            public static async Tasks.Task<Aas.SubmodelElementList> SubmodelElementListFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return SubmodelElementListFrom(bufferedReader, ns);
+                }
+            }
+
+            /// <summary>
+            /// Deserialize an instance of SubmodelElementCollection from <paramref name="reader" />.
+            /// </summary>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of SubmodelElementCollection.
             /// </exception>
-            public static Aas.SubmodelElementList SubmodelElementListFrom(
+            public static Aas.SubmodelElementCollection SubmodelElementCollectionFrom(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.SubmodelElementList? result = (
-                    DeserializeImplementation.SubmodelElementListFromElement(
+                Aas.SubmodelElementCollection? result = (
+                    DeserializeImplementation.SubmodelElementCollectionFromElement(
                         reader,
                         ns,
                         out Reporting.Error? error));
@@ -17959,8 +18624,15 @@ namespace AasCore.Aas3_0_RC02
             }
 
             /// <summary>
-            /// Deserialize an instance of SubmodelElementCollection from <paramref name="reader" />.
+            /// Asynchronously deserialize an instance of SubmodelElementCollection
+            /// from <paramref name="reader" />.
             /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
             /// The expected namespace that the XML elements live in.
@@ -17970,24 +18642,16 @@ namespace AasCore.Aas3_0_RC02
             /// Thrown when the element is not a valid XML
             /// representation of SubmodelElementCollection.
             /// </exception>
-            public static Aas.SubmodelElementCollection SubmodelElementCollectionFrom(
+            public static async Tasks.Task<Aas.SubmodelElementCollection> SubmodelElementCollectionFromAsync(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.SubmodelElementCollection? result = (
-                    DeserializeImplementation.SubmodelElementCollectionFromElement(
-                        reader,
-                        ns,
-                        out Reporting.Error? error));
-                if (error != null)
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
                 {
-                    throw new Xmlization.Exception(
-                        Reporting.GenerateRelativeXPath(error.PathSegments),
-                        error.Cause);
+                    return SubmodelElementCollectionFrom(bufferedReader, ns);
                 }
-                return result
-                    ?? throw new System.InvalidOperationException(
-                        "Unexpected output null when error is null");
             }
 
             /// <summary>
@@ -18022,6 +18686,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of IDataElement
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of IDataElement.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.IDataElement> IDataElementFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return IDataElementFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of Property from <paramref name="reader" />.
             /// </summary>
@@ -18054,6 +18749,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of Property
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Property.
+            /// </exception>
+            public static async Tasks.Task<Aas.Property> PropertyFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return PropertyFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of MultiLanguageProperty from <paramref name="reader" />.
             /// </summary>
@@ -18086,6 +18812,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of MultiLanguageProperty
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of MultiLanguageProperty.
+            /// </exception>
+            public static async Tasks.Task<Aas.MultiLanguageProperty> MultiLanguagePropertyFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return MultiLanguagePropertyFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of Range from <paramref name="reader" />.
             /// </summary>
@@ -18118,6 +18875,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of Range
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Range.
+            /// </exception>
+            public static async Tasks.Task<Aas.Range> RangeFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return RangeFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of ReferenceElement from <paramref name="reader" />.
             /// </summary>
@@ -18150,6 +18938,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of ReferenceElement
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of ReferenceElement.
+            /// </exception>
+            public static async Tasks.Task<Aas.ReferenceElement> ReferenceElementFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return ReferenceElementFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of Blob from <paramref name="reader" />.
             /// </summary>
@@ -18182,6 +19001,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of Blob
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Blob.
+            /// </exception>
+            public static async Tasks.Task<Aas.Blob> BlobFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return BlobFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of File from <paramref name="reader" />.
             /// </summary>
@@ -18214,6 +19064,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of File
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of File.
+            /// </exception>
+            public static async Tasks.Task<Aas.File> FileFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return FileFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of AnnotatedRelationshipElement from <paramref name="reader" />.
             /// </summary>
@@ -18246,6 +19127,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of AnnotatedRelationshipElement
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of AnnotatedRelationshipElement.
+            /// </exception>
+            public static async Tasks.Task<Aas.AnnotatedRelationshipElement> AnnotatedRelationshipElementFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return AnnotatedRelationshipElementFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of Entity from <paramref name="reader" />.
             /// </summary>
@@ -18278,6 +19190,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of Entity
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Entity.
+            /// </exception>
+            public static async Tasks.Task<Aas.Entity> EntityFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return EntityFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of EventPayload from <paramref name="reader" />.
             /// </summary>
@@ -18311,8 +19254,78 @@ namespace AasCore.Aas3_0_RC02
             }
 
             /// <summary>
-            /// Deserialize an instance of IEventElement from <paramref name="reader" />.
+            /// Asynchronously deserialize an instance of EventPayload
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of EventPayload.
+            /// </exception>
+            public static async Tasks.Task<Aas.EventPayload> EventPayloadFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return EventPayloadFrom(bufferedReader, ns);
+                }
+            }
+
+            /// <summary>
+            /// Deserialize an instance of IEventElement from <paramref name="reader" />.
+            /// </summary>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of IEventElement.
+            /// </exception>
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static Aas.IEventElement IEventElementFrom(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                Aas.IEventElement? result = (
+                    DeserializeImplementation.IEventElementFromElement(
+                        reader,
+                        ns,
+                        out Reporting.Error? error));
+                if (error != null)
+                {
+                    throw new Xmlization.Exception(
+                        Reporting.GenerateRelativeXPath(error.PathSegments),
+                        error.Cause);
+                }
+                return result
+                    ?? throw new System.InvalidOperationException(
+                        "Unexpected output null when error is null");
+            }
+
+            /// <summary>
+            /// Asynchronously deserialize an instance of IEventElement
+            /// from <paramref name="reader" />.
             /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
             /// <param name="reader">Initialized XML reader with cursor set to the element</param>
             /// <param name="ns">
             /// The expected namespace that the XML elements live in.
@@ -18322,24 +19335,16 @@ namespace AasCore.Aas3_0_RC02
             /// Thrown when the element is not a valid XML
             /// representation of IEventElement.
             /// </exception>
-            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static Aas.IEventElement IEventElementFrom(
+            [CodeAnalysis.SuppressMessage("ReSharper", "InconsistentNaming")]public static async Tasks.Task<Aas.IEventElement> IEventElementFromAsync(
                 Xml.XmlReader reader,
                 string? ns = null)
             {
-                Aas.IEventElement? result = (
-                    DeserializeImplementation.IEventElementFromElement(
-                        reader,
-                        ns,
-                        out Reporting.Error? error));
-                if (error != null)
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
                 {
-                    throw new Xmlization.Exception(
-                        Reporting.GenerateRelativeXPath(error.PathSegments),
-                        error.Cause);
+                    return IEventElementFrom(bufferedReader, ns);
                 }
-                return result
-                    ?? throw new System.InvalidOperationException(
-                        "Unexpected output null when error is null");
             }
 
             /// <summary>
@@ -18374,6 +19379,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of BasicEventElement
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of BasicEventElement.
+            /// </exception>
+            public static async Tasks.Task<Aas.BasicEventElement> BasicEventElementFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return BasicEventElementFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of Operation from <paramref name="reader" />.
             /// </summary>
@@ -18406,6 +19442,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of Operation
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Operation.
+            /// </exception>
+            public static async Tasks.Task<Aas.Operation> OperationFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return OperationFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of OperationVariable from <paramref name="reader" />.
             /// </summary>
@@ -18438,6 +19505,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of OperationVariable
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of OperationVariable.
+            /// </exception>
+            public static async Tasks.Task<Aas.OperationVariable> OperationVariableFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return OperationVariableFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of Capability from <paramref name="reader" />.
             /// </summary>
@@ -18470,6 +19568,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of Capability
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Capability.
+            /// </exception>
+            public static async Tasks.Task<Aas.Capability> CapabilityFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return CapabilityFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of ConceptDescription from <paramref name="reader" />.
             /// </summary>
@@ -18502,6 +19631,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of ConceptDescription
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of ConceptDescription.
+            /// </exception>
+            public static async Tasks.Task<Aas.ConceptDescription> ConceptDescriptionFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return ConceptDescriptionFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of Reference from <paramref name="reader" />.
             /// </summary>
@@ -18534,6 +19694,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of Reference
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Reference.
+            /// </exception>
+            public static async Tasks.Task<Aas.Reference> ReferenceFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return ReferenceFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of Key from <paramref name="reader" />.
             /// </summary>
@@ -18566,6 +19757,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of Key
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Key.
+            /// </exception>
+            public static async Tasks.Task<Aas.Key> KeyFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return KeyFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of LangString from <paramref name="reader" />.
             /// </summary>
@@ -18598,6 +19820,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of LangString
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of LangString.
+            /// </exception>
+            public static async Tasks.Task<Aas.LangString> LangStringFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return LangStringFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of LangStringSet from <paramref name="reader" />.
             /// </summary>
@@ -18630,6 +19883,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of LangStringSet
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of LangStringSet.
+            /// </exception>
+            public static async Tasks.Task<Aas.LangStringSet> LangStringSetFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return LangStringSetFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of DataSpecificationContent from <paramref name="reader" />.
             /// </summary>
@@ -18662,6 +19946,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of DataSpecificationContent
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of DataSpecificationContent.
+            /// </exception>
+            public static async Tasks.Task<Aas.DataSpecificationContent> DataSpecificationContentFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return DataSpecificationContentFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of DataSpecification from <paramref name="reader" />.
             /// </summary>
@@ -18694,6 +20009,37 @@ namespace AasCore.Aas3_0_RC02
                         "Unexpected output null when error is null");
             }
 
+            /// <summary>
+            /// Asynchronously deserialize an instance of DataSpecification
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of DataSpecification.
+            /// </exception>
+            public static async Tasks.Task<Aas.DataSpecification> DataSpecificationFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return DataSpecificationFrom(bufferedReader, ns);
+                }
+            }
+
             /// <summary>
             /// Deserialize an instance of Environment from <paramref name="reader" />.
             /// </summary>
@@ -18725,6 +20071,37 @@ namespace AasCore.Aas3_0_RC02
                     ?? throw new System.InvalidOperationException(
                         "Unexpected output null when error is null");
             }
+
+            /// <summary>
+            /// Asynchronously deserialize an instance of Environment
+            /// from <paramref name="reader" />.
+            /// </summary>
+            /// <remarks>
+            /// The element is first read asynchronously into a pooled in-memory
+            /// buffer using <see cref="Xml.XmlReader.ReadAsync" />, and then
+            /// deserialized from the buffer. The <paramref name="reader" /> must be
+            /// created with <see cref="Xml.XmlReaderSettings.Async" /> set.
+            /// </remarks>
+            /// <param name="reader">Initialized XML reader with cursor set to the element</param>
+            /// <param name="ns">
+            /// The expected namespace that the XML elements live in.
+            /// If not specified, assume the element names as-are instead of the local names.
+            /// </param>
+            /// <exception cref="Xmlization.Exception">
+            /// Thrown when the element is not a valid XML
+            /// representation of Environment.
+            /// </exception>
+            public static async Tasks.Task<Aas.Environment> EnvironmentFromAsync(
+                Xml.XmlReader reader,
+                string? ns = null)
+            {
+                string buffer = await ReadElementIntoBufferAsync(reader);
+                using (var bufferedReader = Xml.XmlReader.Create(
+                    new System.IO.StringReader(buffer)))
+                {
+                    return EnvironmentFrom(bufferedReader, ns);
+                }
+            }
         }  // public static class Deserialize
 
         /// <summary>
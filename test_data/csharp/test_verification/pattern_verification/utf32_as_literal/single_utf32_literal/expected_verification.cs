@@ -5,6 +5,7 @@
 
 using CodeAnalysis = System.Diagnostics.CodeAnalysis;
 using Regex = System.Text.RegularExpressions.Regex;
+using RegexOptions = System.Text.RegularExpressions.RegexOptions;
 using System.Collections.Generic;  // can't alias
 using System.Linq;  // can't alias
 
@@ -24,14 +25,15 @@ namespace dummyNamespace
         {
             var pattern = "^\\ud800\\udc00$";
 
-            return new Regex(pattern);
+            return new Regex(pattern, RegexOptions.Compiled);
         }
 
-        private static readonly Regex RegexMatchSomething = _constructMatchSomething();
+        private static readonly System.Lazy<Regex> RegexMatchSomething =
+            new System.Lazy<Regex>(_constructMatchSomething);
 
         public static bool MatchSomething(string text)
         {
-            return RegexMatchSomething.IsMatch(text);
+            return RegexMatchSomething.Value.IsMatch(text);
         }
 
         /// <summary>
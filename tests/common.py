@@ -1,5 +1,8 @@
 """Provide common functionality across different tests."""
+import hashlib
 import os
+import pathlib
+import unittest
 from typing import List, Tuple, Optional, Union, Sequence
 
 import asttokens
@@ -98,3 +101,36 @@ RERECORD = os.environ.get("AAS_CORE_CODEGEN_RERECORD", "").lower() in (
     "true",
     "on",
 )
+
+
+def _file_digest(pth: pathlib.Path) -> bytes:
+    """Compute the SHA-256 digest of the file in chunks."""
+    hasher = hashlib.sha256()
+    with pth.open("rb") as fid:
+        for chunk in iter(lambda: fid.read(1024 * 1024), b""):
+            hasher.update(chunk)
+
+    return hasher.digest()
+
+
+def assert_files_equal(
+    test_case: unittest.TestCase,
+    expected_pth: pathlib.Path,
+    output_pth: pathlib.Path,
+) -> None:
+    """
+    Assert that the recorded file and the output file have the same content.
+
+    The files are first compared by their SHA-256 digests, computed in chunks,
+    so that the usual case of equal multi-megabyte outputs does not require
+    both texts in memory. Only on a digest mismatch do we re-read the texts
+    to produce a readable difference.
+    """
+    if _file_digest(expected_pth) == _file_digest(output_pth):
+        return
+
+    test_case.assertEqual(
+        expected_pth.read_text(encoding="utf-8"),
+        output_pth.read_text(encoding="utf-8"),
+        f"The files {expected_pth} and {output_pth} do not match.",
+    )
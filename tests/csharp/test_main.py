@@ -1,5 +1,6 @@
 # pylint: disable=missing-docstring
 
+import concurrent.futures
 import contextlib
 import io
 import os
@@ -90,7 +91,7 @@ class Test_against_recorded(unittest.TestCase):
 
                 # BEFORE-RELEASE (mristin, 2021-12-13):
                 #  check the remainder of the generated files
-                for relevant_rel_pth in [
+                relevant_rel_pths = [
                     pathlib.Path("types.cs"),
                     pathlib.Path("visitation.cs"),
                     pathlib.Path("constants.cs"),
@@ -99,7 +100,9 @@ class Test_against_recorded(unittest.TestCase):
                     pathlib.Path("stringification.cs"),
                     pathlib.Path("jsonization.cs"),
                     pathlib.Path("xmlization.cs"),
-                ]:
+                ]
+
+                def check_or_rerecord(relevant_rel_pth: pathlib.Path) -> None:
                     expected_pth = expected_output_dir / relevant_rel_pth
                     output_pth = output_dir / relevant_rel_pth
 
@@ -108,30 +111,27 @@ class Test_against_recorded(unittest.TestCase):
                             f"The output file is missing: {output_pth}"
                         )
 
-                    try:
-                        output = output_pth.read_text(encoding="utf-8")
-                    except Exception as exception:
-                        raise RuntimeError(
-                            f"Failed to read the output from {output_pth}"
-                        ) from exception
-
                     if tests.common.RERECORD:
-                        expected_pth.write_text(output, encoding="utf-8")
-                    else:
                         try:
-                            expected_output = expected_pth.read_text(encoding="utf-8")
+                            output = output_pth.read_text(encoding="utf-8")
                         except Exception as exception:
                             raise RuntimeError(
-                                f"Failed to read the expected output "
-                                f"from {expected_pth}"
+                                f"Failed to read the output from {output_pth}"
                             ) from exception
 
-                        self.assertEqual(
-                            expected_output,
-                            output,
-                            f"The files {expected_pth} and {output_pth} do not match.",
+                        expected_pth.write_text(output, encoding="utf-8")
+                    else:
+                        tests.common.assert_files_equal(
+                            self, expected_pth, output_pth
                         )
 
+                # NOTE (mristin, 2022-07-12):
+                # The comparisons are independent and the files are large,
+                # so we fan them out over a thread pool.
+                with concurrent.futures.ThreadPoolExecutor() as executor:
+                    for _ in executor.map(check_or_rerecord, relevant_rel_pths):
+                        pass
+
 
 if __name__ == "__main__":
     unittest.main()
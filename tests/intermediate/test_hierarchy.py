@@ -217,5 +217,56 @@ class Test_ontology_fail(unittest.TestCase):
         )
 
 
+class Test_deep_hierarchy(unittest.TestCase):
+    def test_chains_of_increasing_depth(self) -> None:
+        # NOTE (mristin, 2022-07-12):
+        # The deepest chain exceeds what a recursive topological sort can
+        # handle with the default Python recursion limit, so this test pins
+        # down that the ontology construction remains iterative.
+        for depth in [100, 500, 1000]:
+            lines = [
+                "class Thing_0:",
+                "    pass",
+                "",
+            ]
+
+            for i in range(1, depth):
+                lines.extend(
+                    [
+                        f"class Thing_{i}(Thing_{i - 1}):",
+                        "    pass",
+                        "",
+                    ]
+                )
+
+            lines.extend(
+                [
+                    '__book_url__ = "dummy"',
+                    '__book_version__ = "dummy"',
+                    "",
+                ]
+            )
+
+            symbol_table, error = tests.common.parse_source("\n".join(lines))
+
+            assert error is None, tests.common.most_underlying_messages(error)
+            assert symbol_table is not None
+
+            ontology, errors = intermediate_hierarchy.map_symbol_table_to_ontology(
+                symbol_table
+            )
+            assert errors is None, f"{depth=}, {errors=}"
+            assert ontology is not None
+
+            ancestors = ontology.list_ancestors(
+                cls=symbol_table.must_find_class(Identifier(f"Thing_{depth - 1}"))
+            )
+
+            ancestor_names = [cls.name for cls in ancestors]
+            self.assertListEqual(
+                [f"Thing_{i}" for i in range(depth - 1)], ancestor_names
+            )
+
+
 if __name__ == "__main__":
     unittest.main()
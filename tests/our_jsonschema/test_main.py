@@ -123,10 +123,8 @@ class Test_against_recorded(unittest.TestCase):
                             output_pth.read_text(encoding="utf-8"), encoding="utf-8"
                         )
                     else:
-                        self.assertEqual(
-                            expected_pth.read_text(encoding="utf-8"),
-                            output_pth.read_text(encoding="utf-8"),
-                            f"The files {expected_pth} and {output_pth} do not match.",
+                        tests.common.assert_files_equal(
+                            self, expected_pth, output_pth
                         )
 
     def test_on_examples(self) -> None:  # pylint: disable=no-self-use
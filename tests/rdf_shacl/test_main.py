@@ -106,10 +106,8 @@ class Test_against_recorded(unittest.TestCase):
                             encoding="utf-8",
                         )
                     else:
-                        self.assertEqual(
-                            expected_pth.read_text(encoding="utf-8"),
-                            output_pth.read_text(encoding="utf-8"),
-                            f"The files {expected_pth} and {output_pth} do not match.",
+                        tests.common.assert_files_equal(
+                            self, expected_pth, output_pth
                         )
 
 
@@ -0,0 +1,226 @@
+# pylint: disable=missing-docstring
+
+import functools
+import io
+import pathlib
+import pickle
+import tempfile
+import unittest
+import unittest.mock
+from typing import Tuple
+
+import aas_core_meta.v3rc2
+
+import aas_core_codegen
+import aas_core_codegen.main
+from aas_core_codegen import caching, intermediate, parse
+from aas_core_codegen.common import LinenoColumner
+
+import tests.common
+
+
+@functools.lru_cache(maxsize=None)
+def translate_real_meta_model() -> Tuple[intermediate.SymbolTable, LinenoColumner]:
+    """Parse and translate the real meta-model as the main routine would."""
+    assert aas_core_meta.v3rc2.__file__ is not None
+    source = pathlib.Path(aas_core_meta.v3rc2.__file__).read_text(encoding="utf-8")
+
+    atok, parse_exception = parse.source_to_atok(source=source)
+    assert parse_exception is None, f"{parse_exception=}"
+    assert atok is not None
+
+    lineno_columner = LinenoColumner(atok=atok)
+
+    parsed_symbol_table, error = tests.common.parse_atok(atok=atok)
+    assert error is None, tests.common.most_underlying_messages(error)
+    assert parsed_symbol_table is not None
+
+    symbol_table, error = intermediate.translate(
+        parsed_symbol_table=parsed_symbol_table, atok=atok
+    )
+    assert error is None, tests.common.most_underlying_messages(error)
+    assert symbol_table is not None
+
+    return symbol_table, lineno_columner
+
+
+class Test_artifact_round_trip(unittest.TestCase):
+    def test_real_meta_model(self) -> None:
+        symbol_table, lineno_columner = translate_real_meta_model()
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            artifact_pth = pathlib.Path(tmp_dir) / "meta_model.ir"
+
+            caching.dump_artifact(
+                path=artifact_pth,
+                symbol_table=symbol_table,
+                lineno_columner=lineno_columner,
+            )
+
+            result, error = caching.load_artifact(path=artifact_pth)
+
+        assert error is None, error
+        assert result is not None
+
+        loaded_symbol_table, _ = result
+
+        # NOTE (mristin, 2022-07-12):
+        # The stringified dump covers the whole symbol table including the
+        # descriptions, so the equality of the dumps means that the documents
+        # survived the round trip.
+        self.assertEqual(
+            intermediate.dump(symbol_table), intermediate.dump(loaded_symbol_table)
+        )
+
+        # NOTE (mristin, 2022-07-12):
+        # The documents must come back without the unpicklable machinery.
+        for our_type in loaded_symbol_table.our_types:
+            if our_type.description is None:
+                continue
+
+            document = our_type.description.parsed.document
+            assert document.reporter is None, f"{our_type.name=}"
+            assert document.transformer is None, f"{our_type.name=}"
+            assert document.settings is None, f"{our_type.name=}"
+
+
+class Test_cache_store_and_load(unittest.TestCase):
+    def test_round_trip(self) -> None:
+        symbol_table, lineno_columner = translate_real_meta_model()
+
+        stderr = io.StringIO()
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            cache_dir = pathlib.Path(tmp_dir)
+
+            caching.store(
+                cache_dir=cache_dir,
+                key="some-key",
+                symbol_table=symbol_table,
+                lineno_columner=lineno_columner,
+                stderr=stderr,
+            )
+
+            self.assertEqual("", stderr.getvalue())
+
+            cached = caching.load(cache_dir=cache_dir, key="some-key")
+
+        assert cached is not None, (
+            "Expected a cache hit after a store of the real meta-model"
+        )
+
+        loaded_symbol_table, _ = cached
+        self.assertEqual(
+            intermediate.dump(symbol_table), intermediate.dump(loaded_symbol_table)
+        )
+
+    def test_warning_on_failed_store(self) -> None:
+        symbol_table, lineno_columner = translate_real_meta_model()
+
+        stderr = io.StringIO()
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            # NOTE (mristin, 2022-07-12):
+            # The cache directory deliberately points to an existing *file*,
+            # so the store must fail and report it instead of passing silently.
+            bogus_cache_dir = pathlib.Path(tmp_dir) / "a_file"
+            bogus_cache_dir.write_text("not a directory", encoding="utf-8")
+
+            caching.store(
+                cache_dir=bogus_cache_dir,
+                key="some-key",
+                symbol_table=symbol_table,
+                lineno_columner=lineno_columner,
+                stderr=stderr,
+            )
+
+        self.assertIn("Warning: failed to store the cache entry", stderr.getvalue())
+
+
+class Test_cache_dir_in_main(unittest.TestCase):
+    def test_second_run_hits_the_cache(self) -> None:
+        assert aas_core_meta.v3rc2.__file__ is not None
+        model_pth = pathlib.Path(aas_core_meta.v3rc2.__file__)
+
+        repo_root = pathlib.Path(__file__).parent.parent
+        snippets_dir = (
+            repo_root
+            / "test_data/xsd/test_main/aas_core_meta.v3rc2/input/snippets"
+        )
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            cache_dir = pathlib.Path(tmp_dir) / "cache"
+            output_dir = pathlib.Path(tmp_dir) / "output"
+
+            params = aas_core_codegen.main.Parameters(
+                model_path=model_pth,
+                target=aas_core_codegen.main.Target.XSD,
+                snippets_dir=snippets_dir,
+                output_dir=output_dir,
+                cache_dir=cache_dir,
+            )
+
+            stdout = io.StringIO()
+            stderr = io.StringIO()
+
+            return_code = aas_core_codegen.main.execute(
+                params=params, stdout=stdout, stderr=stderr
+            )
+            self.assertEqual(0, return_code, stderr.getvalue())
+            self.assertEqual("", stderr.getvalue())
+
+            cache_entries = sorted(cache_dir.glob("*.pickle"))
+            self.assertEqual(
+                1, len(cache_entries), "Expected exactly one cache entry"
+            )
+
+            # NOTE (mristin, 2022-07-12):
+            # If the second run had to parse and translate again, this patch
+            # would make it fail, so a successful run proves the cache hit.
+            with unittest.mock.patch.object(
+                aas_core_codegen.main,
+                "_parse_and_translate",
+                side_effect=AssertionError(
+                    "Expected no parsing and translation on a cache hit"
+                ),
+            ):
+                stdout = io.StringIO()
+                stderr = io.StringIO()
+
+                return_code = aas_core_codegen.main.execute(
+                    params=params, stdout=stdout, stderr=stderr
+                )
+
+            self.assertEqual(0, return_code, stderr.getvalue())
+            self.assertEqual("", stderr.getvalue())
+
+
+class Test_load_artifact_errors(unittest.TestCase):
+    def test_not_an_artifact(self) -> None:
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            pth = pathlib.Path(tmp_dir) / "not_an_artifact.ir"
+            pth.write_bytes(b"spurious content")
+
+            result, error = caching.load_artifact(path=pth)
+
+        assert result is None
+        assert error is not None
+        self.assertIn("not a compiled meta-model artifact", error)
+
+    def test_version_mismatch(self) -> None:
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            pth = pathlib.Path(tmp_dir) / "stale.ir"
+            pth.write_bytes(
+                caching._ARTIFACT_MAGIC + b"0.0.0\x00" + pickle.dumps(None)
+            )
+
+            result, error = caching.load_artifact(path=pth)
+
+        assert result is None
+        assert error is not None
+        self.assertIn("0.0.0", error)
+        self.assertIn(aas_core_codegen.__version__, error)
+
+
+if __name__ == "__main__":
+    unittest.main()
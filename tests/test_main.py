@@ -0,0 +1,263 @@
+# pylint: disable=missing-docstring
+
+import io
+import os
+import pathlib
+import shutil
+import tarfile
+import tempfile
+import unittest
+import unittest.mock
+
+import aas_core_meta.v3rc2
+
+import aas_core_codegen.main
+
+import tests.common
+
+_REPO_DIR = pathlib.Path(os.path.realpath(__file__)).parent.parent
+
+
+def _real_model_path() -> pathlib.Path:
+    assert aas_core_meta.v3rc2.__file__ is not None
+    return pathlib.Path(aas_core_meta.v3rc2.__file__)
+
+
+class Test_output_bundle(unittest.TestCase):
+    def test_bundle_matches_the_output_dir(self) -> None:
+        model_pth = _real_model_path()
+
+        snippets_dir = (
+            _REPO_DIR
+            / "test_data/xsd/test_main/aas_core_meta.v3rc2/input/snippets"
+        )
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            output_dir = pathlib.Path(tmp_dir) / "output"
+            bundle_pth = pathlib.Path(tmp_dir) / "artifacts.tar"
+
+            stdout = io.StringIO()
+            stderr = io.StringIO()
+
+            return_code = aas_core_codegen.main.execute(
+                params=aas_core_codegen.main.Parameters(
+                    model_path=model_pth,
+                    target=aas_core_codegen.main.Target.XSD,
+                    snippets_dir=snippets_dir,
+                    output_dir=output_dir,
+                ),
+                stdout=stdout,
+                stderr=stderr,
+            )
+            self.assertEqual(0, return_code, stderr.getvalue())
+
+            stdout = io.StringIO()
+            stderr = io.StringIO()
+
+            return_code = aas_core_codegen.main.execute(
+                params=aas_core_codegen.main.Parameters(
+                    model_path=model_pth,
+                    target=aas_core_codegen.main.Target.XSD,
+                    snippets_dir=snippets_dir,
+                    output_bundle=bundle_pth,
+                ),
+                stdout=stdout,
+                stderr=stderr,
+            )
+            self.assertEqual(0, return_code, stderr.getvalue())
+            self.assertEqual("", stderr.getvalue())
+            self.assertIn(f"Bundle written to: {bundle_pth}", stdout.getvalue())
+
+            expected_names = sorted(
+                pth.relative_to(output_dir).as_posix()
+                for pth in output_dir.glob("**/*")
+                if pth.is_file()
+            )
+            assert len(expected_names) > 0, (
+                "Expected the directory run to produce at least one file"
+            )
+
+            with tarfile.open(str(bundle_pth), mode="r") as tar:
+                self.assertListEqual(expected_names, tar.getnames())
+
+                for name in expected_names:
+                    extracted = tar.extractfile(name)
+                    assert extracted is not None, name
+
+                    self.assertEqual(
+                        (output_dir / name).read_bytes(),
+                        extracted.read(),
+                        f"The bundled content differs for: {name}",
+                    )
+
+
+class Test_multi_target(unittest.TestCase):
+    def test_against_recorded_single_target_outputs(self) -> None:
+        model_pth = _real_model_path()
+
+        jsonschema_case_dir = (
+            _REPO_DIR / "test_data/jsonschema/test_main/aas_core_meta.v3rc2"
+        )
+        xsd_case_dir = _REPO_DIR / "test_data/xsd/test_main/aas_core_meta.v3rc2"
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            # NOTE (mristin, 2022-07-12):
+            # A multi-target run shares a single snippets directory among all
+            # the targets, so we merge the recorded single-target snippets.
+            snippets_dir = pathlib.Path(tmp_dir) / "snippets"
+            for case_dir in (jsonschema_case_dir, xsd_case_dir):
+                shutil.copytree(
+                    str(case_dir / "input/snippets"),
+                    str(snippets_dir),
+                    dirs_exist_ok=True,
+                )
+
+            output_dir = pathlib.Path(tmp_dir) / "output"
+
+            stdout = io.StringIO()
+            stderr = io.StringIO()
+
+            return_code = aas_core_codegen.main.execute(
+                params=aas_core_codegen.main.Parameters(
+                    model_path=model_pth,
+                    targets=[
+                        aas_core_codegen.main.Target.JSONSCHEMA,
+                        aas_core_codegen.main.Target.XSD,
+                    ],
+                    snippets_dir=snippets_dir,
+                    output_dir=output_dir,
+                ),
+                stdout=stdout,
+                stderr=stderr,
+            )
+            self.assertEqual(0, return_code, stderr.getvalue())
+            self.assertEqual("", stderr.getvalue())
+
+            # NOTE (mristin, 2022-07-12):
+            # The targets run in parallel, but the output is reported
+            # deterministically in the order of the targets.
+            normalized_stdout = stdout.getvalue().replace(
+                str(output_dir), "<output dir>"
+            )
+            self.assertEqual(
+                (jsonschema_case_dir / "expected_output/stdout.txt").read_text(
+                    encoding="utf-8"
+                )
+                + (xsd_case_dir / "expected_output/stdout.txt").read_text(
+                    encoding="utf-8"
+                ),
+                normalized_stdout,
+            )
+
+            for expected_pth, output_pth in [
+                (
+                    jsonschema_case_dir / "expected_output/schema.json",
+                    output_dir / "schema.json",
+                ),
+                (
+                    xsd_case_dir / "expected_output/schema.xsd",
+                    output_dir / "schema.xsd",
+                ),
+            ]:
+                if not output_pth.exists():
+                    raise FileNotFoundError(
+                        f"The output file is missing: {output_pth}"
+                    )
+
+                tests.common.assert_files_equal(self, expected_pth, output_pth)
+
+
+class Test_watch_machinery(unittest.TestCase):
+    def test_snapshot_detects_changes(self) -> None:
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            model_pth = pathlib.Path(tmp_dir) / "meta_model.py"
+            model_pth.write_text("# a meta-model", encoding="utf-8")
+
+            snippets_dir = pathlib.Path(tmp_dir) / "snippets"
+            snippets_dir.mkdir()
+            snippet_pth = snippets_dir / "some_snippet.xml"
+            snippet_pth.write_text("<some-snippet/>", encoding="utf-8")
+
+            params = aas_core_codegen.main.Parameters(
+                model_path=model_pth,
+                target=aas_core_codegen.main.Target.XSD,
+                snippets_dir=snippets_dir,
+                output_dir=pathlib.Path(tmp_dir) / "output",
+            )
+
+            snapshot = aas_core_codegen.main._snapshot_of_inputs(params=params)
+            self.assertSetEqual(
+                {str(model_pth), str(snippet_pth)}, set(snapshot.keys())
+            )
+
+            self.assertEqual(
+                snapshot,
+                aas_core_codegen.main._snapshot_of_inputs(params=params),
+                "Expected the snapshot to be stable on untouched inputs",
+            )
+
+            snippet_pth.write_text("<some-snippet>changed</some-snippet>",
+                                   encoding="utf-8")
+
+            self.assertNotEqual(
+                snapshot,
+                aas_core_codegen.main._snapshot_of_inputs(params=params),
+                "Expected the snapshot to change on a touched snippet",
+            )
+
+    def test_translation_memo_skips_the_translation(self) -> None:
+        model_pth = _real_model_path()
+
+        snippets_dir = (
+            _REPO_DIR
+            / "test_data/xsd/test_main/aas_core_meta.v3rc2/input/snippets"
+        )
+
+        translation_memo = dict()  # type: aas_core_codegen.main.TranslationMemo
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            params = aas_core_codegen.main.Parameters(
+                model_path=model_pth,
+                target=aas_core_codegen.main.Target.XSD,
+                snippets_dir=snippets_dir,
+                output_dir=pathlib.Path(tmp_dir) / "output",
+            )
+
+            stdout = io.StringIO()
+            stderr = io.StringIO()
+
+            return_code = aas_core_codegen.main.execute(
+                params=params,
+                stdout=stdout,
+                stderr=stderr,
+                translation_memo=translation_memo,
+            )
+            self.assertEqual(0, return_code, stderr.getvalue())
+            self.assertEqual(1, len(translation_memo))
+
+            # NOTE (mristin, 2022-07-12):
+            # If the second run had to parse and translate again, this patch
+            # would make it fail, so a successful run proves the memo hit.
+            with unittest.mock.patch.object(
+                aas_core_codegen.main,
+                "_parse_and_translate",
+                side_effect=AssertionError(
+                    "Expected no parsing and translation on a memo hit"
+                ),
+            ):
+                stdout = io.StringIO()
+                stderr = io.StringIO()
+
+                return_code = aas_core_codegen.main.execute(
+                    params=params,
+                    stdout=stdout,
+                    stderr=stderr,
+                    translation_memo=translation_memo,
+                )
+
+            self.assertEqual(0, return_code, stderr.getvalue())
+            self.assertEqual("", stderr.getvalue())
+
+
+if __name__ == "__main__":
+    unittest.main()